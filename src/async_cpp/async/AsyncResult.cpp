@@ -1,29 +1,39 @@
 #include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/detail/ResultState.h"
+#include "async_cpp/tasks/IManager.h"
+#include "async_cpp/tasks/Task.h"
+
+#include <algorithm>
+#include <stdexcept>
 
 namespace async_cpp {
 namespace async {
 
 //------------------------------------------------------------------------------
 AsyncResult::AsyncResult(std::future<bool>&& future) 
-    : mFuture(std::make_shared<std::future<bool>>(std::move(future)))
+    : mState(std::make_shared<detail::ResultState>(future.share()))
 {
 
 }
 
+//------------------------------------------------------------------------------
+AsyncResult::AsyncResult(std::shared_ptr<detail::ResultState> state, std::weak_ptr<tasks::Task> owner) 
+    : mState(state), mOwner(owner)
+{
+    if(!mState) { throw(std::invalid_argument("AsyncResult: State cannot be null")); }
+}
+
 //------------------------------------------------------------------------------
 AsyncResult::AsyncResult()
 {
-    std::promise<bool> promise;
-    mFuture = std::make_shared<std::future<bool>>(promise.get_future());
-    promise.set_value(true);
+
 }
 
 //------------------------------------------------------------------------------
 AsyncResult::AsyncResult(std::exception_ptr ex)
+    : mException(ex)
 {
-    std::promise<bool> promise;
-    mFuture = std::make_shared<std::future<bool>>(promise.get_future());
-    promise.set_exception(ex);
+
 }
 
 //------------------------------------------------------------------------------
@@ -35,17 +45,101 @@ AsyncResult::~AsyncResult()
 //------------------------------------------------------------------------------
 void AsyncResult::check()
 {
-    mFuture->get();
+    if(mState)
+    {
+        waitUntilReady(std::chrono::steady_clock::time_point::max());
+        auto ex = mState->exception();
+        if(ex) std::rethrow_exception(ex);
+    }
+    else if(mException)
+    {
+        std::rethrow_exception(mException);
+    }
+}
+
+//------------------------------------------------------------------------------
+tasks::WaitStatus AsyncResult::waitUntil(const std::chrono::steady_clock::time_point& time, const bool cancelOnTimeout)
+{
+    if(!waitUntilReady(time))
+    {
+        if(cancelOnTimeout)
+        {
+            cancel();
+        }
+        return tasks::WaitStatus::Timeout;
+    }
+
+    auto ex = mState ? mState->exception() : mException;
+    return ex ? tasks::WaitStatus::Failed : tasks::WaitStatus::Ready;
+}
+
+//------------------------------------------------------------------------------
+void AsyncResult::cancel()
+{
+    //the owner may already have been performed while still producing the result, such as a collect task re-queued to 
+    //wait on outstanding results, so cancelling it has no effect
+    auto owner = mOwner.lock();
+    if(owner && owner->cancel())
+    {
+        return;
+    }
+    if(mState)
+    {
+        //no task to cancel, fail the result itself, claiming it so a producer which has not yet finished it skips doing so
+        mState->claim();
+        mState->complete(std::make_exception_ptr(std::runtime_error("Cancelled")));
+    }
+}
+
+//------------------------------------------------------------------------------
+void AsyncResult::onComplete(std::function<void(std::exception_ptr)> continuation)
+{
+    if(mState)
+    {
+        mState->addContinuation(continuation);
+    }
+    else
+    {
+        continuation(mException);
+    }
+}
+
+//------------------------------------------------------------------------------
+bool AsyncResult::waitUntilReady(const std::chrono::steady_clock::time_point& time)
+{
+    //when called from a worker, perform other queued tasks rather than blocking the worker
+    auto manager = tasks::IManager::current();
+    while(!isReady())
+    {
+        auto now = std::chrono::steady_clock::now();
+        if(now >= time)
+        {
+            return false;
+        }
+
+        if(manager)
+        {
+            if(!manager->runQueuedTask())
+            {
+                mState->waitUntil(std::min(time, now + std::chrono::microseconds(100)));
+            }
+        }
+        else if(std::chrono::steady_clock::time_point::max() == time)
+        {
+            mState->wait();
+        }
+        else
+        {
+            mState->waitUntil(time);
+        }
+    }
+    return true;
 }
 
 //------------------------------------------------------------------------------
 bool AsyncResult::isReady() const
 {
-#ifdef _MSC_VER //wait_for is broken in VC11 have to use MS specific _Is_ready
-    return mFuture->_Is_ready();
-#else
-    return (std::future_status::ready == mFuture->wait_for(std::chrono::milliseconds(0)));
-#endif
+    return isImmediate() || mState->isReady();
 }
 
 }
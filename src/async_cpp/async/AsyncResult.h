@@ -1,13 +1,20 @@
 #pragma once
 #include "async_cpp/async/Async.h"
 
+#include <chrono>
+#include <functional>
 #include <future>
 
 namespace async_cpp {
 namespace async {
 
+namespace detail {
+class ResultState;
+}
+
 /**
- * Store the result of an asynchronous operation, either as an error or successful
+ * Store the result of an asynchronous operation, either as an error or successful. Copies share the same result, 
+ * so any number of consumers may wait on it or attach continuations.
  */
 //------------------------------------------------------------------------------
 class AsyncResult {
@@ -17,32 +24,94 @@ public:
      */
     AsyncResult(std::future<bool>&& mFuture);
     /**
-     * Create a result that was an exception
+     * Create a result that was valid, and waiting on completion of a shared state. Cancelling the result cancels the 
+     * owning task, if any.
+     */
+    AsyncResult(std::shared_ptr<detail::ResultState> state, std::weak_ptr<tasks::Task> owner = std::weak_ptr<tasks::Task>());
+    /**
+     * Create a result that was an exception. Stored inline, no shared state is allocated.
      */
     AsyncResult(std::exception_ptr ex);
     /**
-     * Create a finished, successful, async result
+     * Create a finished, successful, async result. Stored inline, no shared state is allocated.
      */
     AsyncResult();
     
     virtual ~AsyncResult();
 
     /**
-     * Check this asynchronous result. If failed, exception will be thrown.
+     * Check this asynchronous result. If failed, exception will be thrown. If called while performing a managed task,
+     * other queued tasks from that manager are run until this result is ready.
      */
     void check();
 
+    /**
+     * Wait a bounded amount of time for this result. As with check, queued tasks are run if called from a worker.
+     * @param duration Maximum time to wait
+     * @param cancelOnTimeout Cancel the operation producing this result if not ready in time
+     * @return Ready if successful, Failed if result is an exception, Timeout if not ready in time
+     */
+    template<class TREP, class TPERIOD>
+    tasks::WaitStatus waitFor(const std::chrono::duration<TREP, TPERIOD>& duration, const bool cancelOnTimeout = false);
+
+    /**
+     * Wait until a point in time for this result. As with check, queued tasks are run if called from a worker.
+     * @param time Time to stop waiting at
+     * @param cancelOnTimeout Cancel the operation producing this result if not ready in time
+     * @return Ready if successful, Failed if result is an exception, Timeout if not ready in time
+     */
+    tasks::WaitStatus waitUntil(const std::chrono::steady_clock::time_point& time, const bool cancelOnTimeout = false);
+
+    /**
+     * Cancel the operation producing this result, if it has not completed. Result will be an exception. Results without 
+     * an owning task, such as those created from a future or by Coroutine::then, or whose owning task was already 
+     * performed, fail immediately, while the work producing them carries on and its completion is ignored.
+     */
+    void cancel();
+
+    /**
+     * Invoke a function once this result is ready, on the thread completing the result. If already ready, the 
+     * function is invoked immediately. Continuations should be short, or pass work on to a manager.
+     * @param continuation Function to invoke with the exception this result failed with, null if successful
+     */
+    void onComplete(std::function<void(std::exception_ptr)> continuation);
+
     /**
      * Check if this result is ready.
      */
     bool isReady() const;
 
+    /**
+     * Check if this result was created already finished (successful or failed), rather than waiting on a future.
+     * @return True if result was created finished
+     */
+    inline bool isImmediate() const;
+
 private:
-    std::shared_ptr<std::future<bool>> mFuture;
+    bool waitUntilReady(const std::chrono::steady_clock::time_point& time);
+
+    std::shared_ptr<detail::ResultState> mState;
+    std::exception_ptr mException;
+    std::weak_ptr<tasks::Task> mOwner;
 };
 
 //inline implementations
 //------------------------------------------------------------------------------
+bool AsyncResult::isImmediate() const
+{
+    return !mState;
+}
+
+//------------------------------------------------------------------------------
+template<class TREP, class TPERIOD>
+tasks::WaitStatus AsyncResult::waitFor(const std::chrono::duration<TREP, TPERIOD>& duration, const bool cancelOnTimeout)
+{
+    return waitUntil(std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(duration), cancelOnTimeout);
+}
 
 }
-}
\ No newline at end of file
+}
+
+#if defined(__cpp_impl_coroutine)
+#include "async_cpp/async/detail/ResultAwaiter.h"
+#endif
\ No newline at end of file
@@ -0,0 +1,7 @@
+#include "async_cpp/async/Coroutine.h"
+
+namespace async_cpp {
+namespace async {
+
+}
+}
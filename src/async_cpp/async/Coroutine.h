@@ -0,0 +1,144 @@
+#pragma once
+#include "async_cpp/async/Async.h"
+#include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/detail/CoroutinePromise.h"
+#include "async_cpp/async/detail/CoroutineTask.h"
+#include "async_cpp/async/detail/ResultState.h"
+
+#include "async_cpp/tasks/IManager.h"
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#include <functional>
+#include <stdexcept>
+
+namespace async_cpp {
+namespace async {
+
+/**
+ * Lazily started coroutine, allowing a multi step asynchronous operation to be written using co_await rather than a 
+ * Series of callbacks. A coroutine does not run until it is awaited by another coroutine, or started on a manager 
+ * using then. Within a coroutine, co_await manager->schedule() resumes on a worker of that manager, and co_await on 
+ * an AsyncResult resumes once the result is ready.
+ */
+//------------------------------------------------------------------------------
+template<class TRESULT>
+class Coroutine {
+public:
+    typedef detail::CoroutinePromise<TRESULT> promise_type;
+    typedef std::function<void(std::exception_ptr, TRESULT*)> then_t;
+
+    Coroutine(std::coroutine_handle<promise_type> handle);
+    Coroutine(Coroutine&& other);
+    ~Coroutine();
+
+    /**
+     * Start this coroutine as a task run by a manager, invoking a function with its result once complete. Cancelling 
+     * the returned result fails it without stopping the coroutine, and the function is then not invoked.
+     * @param manager Manager to start coroutine on
+     * @param thenFunc Function to invoke with coroutine result, or the exception the coroutine ended with
+     * @return AsyncResult that holds a future completion status, either successful or exception
+     */
+    AsyncResult then(tasks::ManagerPtr manager, then_t thenFunc);
+
+    bool await_ready() const;
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting);
+    TRESULT await_resume();
+
+private:
+    Coroutine(const Coroutine& other);
+
+    std::coroutine_handle<promise_type> mHandle;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TRESULT>
+Coroutine<TRESULT>::Coroutine(std::coroutine_handle<promise_type> handle)
+    : mHandle(handle)
+{
+
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+Coroutine<TRESULT>::Coroutine(Coroutine&& other)
+    : mHandle(other.mHandle)
+{
+    other.mHandle = nullptr;
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+Coroutine<TRESULT>::~Coroutine()
+{
+    if(mHandle) mHandle.destroy();
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+AsyncResult Coroutine<TRESULT>::then(tasks::ManagerPtr manager, then_t thenFunc)
+{
+    if(!manager) { throw(std::invalid_argument("Coroutine: Manager cannot be null")); }
+    if(!mHandle) { throw(std::runtime_error("Coroutine: Already started")); }
+
+    auto state = std::make_shared<detail::ResultState>();
+    auto result = AsyncResult(state);
+
+    //coroutine now owns itself, destroying itself once complete
+    auto handle = mHandle;
+    mHandle = nullptr;
+    auto& promise = handle.promise();
+    promise.detach([thenFunc, state, &promise]()->void
+    {
+        //result may have been cancelled, only finish once
+        if(!state->claim()) return;
+
+        auto ex = promise.exception();
+        try
+        {
+            thenFunc(ex, promise.value());
+        }
+        catch(...)
+        {
+            ex = std::current_exception();
+        }
+        state->complete(ex);
+    } );
+    manager->run(std::make_shared<detail::CoroutineTask<promise_type>>(handle));
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+bool Coroutine<TRESULT>::await_ready() const
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+std::coroutine_handle<> Coroutine<TRESULT>::await_suspend(std::coroutine_handle<> awaiting)
+{
+    //run this coroutine on the awaiting thread, resuming the awaiting coroutine once complete
+    mHandle.promise().setContinuation(awaiting);
+    return mHandle;
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+TRESULT Coroutine<TRESULT>::await_resume()
+{
+    auto& promise = mHandle.promise();
+    if(promise.exception()) std::rethrow_exception(promise.exception());
+    if constexpr (!std::is_void<TRESULT>::value)
+    {
+        return std::move(*promise.value());
+    }
+}
+
+}
+}
+
+#endif
\ No newline at end of file
@@ -1,27 +1,58 @@
 #pragma once
 #include "async_cpp/async/ParallelForEach.h"
+#include "async_cpp/async/detail/Compaction.h"
 
 namespace async_cpp {
 namespace async {
 
 /**
- * Filter a set of data using a criteria
+ * Filter a set of data using a criteria. Data is split into blocks which evaluate the criteria and count passing data in 
+ * parallel, counts are scanned into output offsets, and each block moves its passing data into the output in parallel, 
+ * keeping the original order. Data without a default value is instead gathered per block and moved into the output in 
+ * order. Element criteria are called through a std::function for each item. Only block criteria, such as one made by 
+ * kernel from a lambda, flag a contiguous block of trivially copyable data in one call, giving the compiler a loop it 
+ * can inline and vectorize. Passing trivially copyable data is written to the output without a branch per item.
  */
 //------------------------------------------------------------------------------
 template<class TDATA>
 class Filter {
 public:
     typedef typename std::function<bool(const TDATA&)> filter_t;
+    typedef typename std::function<void(const TDATA*, uint8_t*, const size_t)> block_filter_t;
     typedef typename ParallelForEach<TDATA>::then_t then_t;
     /**
      * Create a filter operation that will filter a set of data based on an operation.
      * @param manager Manager to use with filter operation
      * @param filterOp Operation to use for filtering
      * @param data Data to be filtered
+     * @param grainSize Number of items in each block, chosen from the data size if zero
      */
     Filter(tasks::ManagerPtr manager, 
         typename filter_t filterOp,
-        std::vector<TDATA>&& data);
+        std::vector<TDATA>&& data,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a filter operation which evaluates contiguous blocks of trivially copyable data other than bool with a 
+     * block criteria.
+     * @param manager Manager to use with filter operation
+     * @param blockOp Operation setting a flag for each of a number of items of data, 1 to keep the item and 0 to drop it
+     * @param data Data to be filtered
+     * @param grainSize Number of items in each block, chosen from the data size if zero
+     */
+    Filter(tasks::ManagerPtr manager, 
+        typename block_filter_t blockOp,
+        std::vector<TDATA>&& data,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a block criteria applying an element criteria to each item of a block. The element criteria is called 
+     * directly rather than through a std::function, so it can be inlined and the loop vectorized.
+     * @param elementOp Operation returning true for items to keep, such as a lambda
+     * @return Block criteria to filter with
+     */
+    template<class TOP>
+    static block_filter_t kernel(TOP elementOp);
 
     /**
      * Run the operation across the set of data, invoking a task with the filtered results
@@ -35,10 +66,31 @@ public:
     void cancel();
 
 private:
+    //bools are packed, so have no contiguous block to pass to a block criteria
+    typedef std::integral_constant<bool, 
+        std::is_trivially_copyable<TDATA>::value && !std::is_same<TDATA, bool>::value> is_blockable_t;
+
+    static void evaluateBlock(const std::vector<TDATA>& data, 
+        uint8_t* keep, 
+        const size_t first, 
+        const size_t last, 
+        const typename filter_t& op, 
+        const typename block_filter_t& blockOp, 
+        std::true_type isBlockable);
+    static void evaluateBlock(const std::vector<TDATA>& data, 
+        uint8_t* keep, 
+        const size_t first, 
+        const size_t last, 
+        const typename filter_t& op, 
+        const typename block_filter_t& blockOp, 
+        std::false_type isBlockable);
+
     typename filter_t mOp;
+    typename block_filter_t mBlockOp;
     tasks::ManagerPtr mManager;
     std::vector<TDATA> mData;
-    std::shared_ptr<ParallelForEach<TDATA>> mParallel;
+    size_t mGrainSize;
+    std::shared_ptr<tasks::Task> mTask;
 };
 
 //inline implementations
@@ -46,36 +98,133 @@ private:
 template<class TDATA>
 Filter<TDATA>::Filter(tasks::ManagerPtr manager, 
                       typename filter_t filterOp, 
-                      std::vector<TDATA>&& data)
-    : mManager(manager), mOp(filterOp), mData(std::move(data))
+                      std::vector<TDATA>&& data,
+                      const size_t grainSize)
+    : mManager(manager), mOp(filterOp), mData(std::move(data)), mGrainSize(grainSize)
 {
+    if(!mManager) { throw(std::invalid_argument("Filter: Manager cannot be null")); }
+    if(!mOp) { throw(std::invalid_argument("Filter: Filter operation cannot be null")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mData.size()); }
+}
 
+//------------------------------------------------------------------------------
+template<class TDATA>
+Filter<TDATA>::Filter(tasks::ManagerPtr manager, 
+                      typename block_filter_t blockOp, 
+                      std::vector<TDATA>&& data,
+                      const size_t grainSize)
+    : mManager(manager), mBlockOp(blockOp), mData(std::move(data)), mGrainSize(grainSize)
+{
+    static_assert(is_blockable_t::value, "Filter: Block criteria require trivially copyable data other than bool");
+    if(!mManager) { throw(std::invalid_argument("Filter: Manager cannot be null")); }
+    if(!mBlockOp) { throw(std::invalid_argument("Filter: Block criteria cannot be null")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mData.size()); }
 }
 
 //------------------------------------------------------------------------------
 template<class TDATA>
-AsyncResult Filter<TDATA>::then(typename then_t onFilter)
+template<class TOP>
+typename Filter<TDATA>::block_filter_t Filter<TDATA>::kernel(TOP elementOp)
 {
-    auto filterOpCopy(mOp);
-    auto op = [filterOpCopy](TDATA& value, typename detail::ParallelTask<TDATA>::callback_t callback) -> void {
-        if(filterOpCopy(value))
+    return [elementOp](const TDATA* data, uint8_t* keep, const size_t size)->void
+    {
+        for(size_t i = 0; i < size; ++i)
         {
-            callback(std::move(value));
+            keep[i] = elementOp(data[i]) ? 1 : 0;
         }
-        else
+    };
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+AsyncResult Filter<TDATA>::then(typename then_t onFilter)
+{
+    auto task = std::make_shared<detail::PhasedTask<std::vector<TDATA>>>(mManager, 
+        [onFilter](std::exception_ptr ex, std::vector<TDATA>* results)->void
+        {
+            onFilter(ex, results ? std::move(*results) : std::vector<TDATA>());
+        } );
+    mTask = task;
+    auto result = task->result();
+
+    auto data = std::make_shared<std::vector<TDATA>>(std::move(mData));
+    auto op = mOp;
+    auto blockOp = mBlockOp;
+    auto grainSize = mGrainSize;
+    auto nbBlocks = (data->size() + grainSize - 1) / grainSize;
+    auto keep = std::make_shared<std::vector<uint8_t>>(data->size(), 0);
+    auto counts = std::make_shared<std::vector<size_t>>(nbBlocks, 0);
+    auto evaluate = [data, op, blockOp, keep, counts, grainSize](const size_t begin, const size_t end)->void
+    {
+        for(size_t block = begin; block < end; ++block)
         {
-            callback(AsyncResult());
+            auto first = block * grainSize;
+            auto last = std::min(data->size(), first + grainSize);
+            auto flags = keep->data();
+            evaluateBlock(*data, flags, first, last, op, blockOp, is_blockable_t());
+
+            //flags are 0 or 1, so summing counts without a branch per item
+            size_t count = 0;
+            for(size_t i = first; i < last; ++i)
+            {
+                count += flags[i];
+            }
+            (*counts)[block] = count;
         }
     };
-    mParallel = std::make_shared<ParallelForEach<TDATA>>(mManager, op, std::move(mData));
-    return mParallel->then(onFilter);
+
+    task->runPhase(nbBlocks, 1, evaluate, [task, data, keep, counts, grainSize]()->void
+    {
+        detail::scatterKept<TDATA>(task, data, keep, counts, grainSize, 
+            [task](std::shared_ptr<std::vector<TDATA>> results)->void
+            {
+                task->finish(results.get());
+            } );
+    } );
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+void Filter<TDATA>::evaluateBlock(const std::vector<TDATA>& data, 
+    uint8_t* keep, 
+    const size_t first, 
+    const size_t last, 
+    const typename filter_t& op, 
+    const typename block_filter_t& blockOp, 
+    std::true_type)
+{
+    //element criteria evaluate item by item
+    if(!blockOp)
+    {
+        evaluateBlock(data, keep, first, last, op, blockOp, std::false_type());
+        return;
+    }
+    blockOp(data.data() + first, keep + first, last - first);
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+void Filter<TDATA>::evaluateBlock(const std::vector<TDATA>& data, 
+    uint8_t* keep, 
+    const size_t first, 
+    const size_t last, 
+    const typename filter_t& op, 
+    const typename block_filter_t&, 
+    std::false_type)
+{
+    for(size_t i = first; i < last; ++i)
+    {
+        keep[i] = op(data[i]) ? 1 : 0;
+    }
 }
 
 //------------------------------------------------------------------------------
 template<class TDATA>
 void Filter<TDATA>::cancel()
 {
-    if(mParallel) mParallel->cancel();
+    if(mTask) mTask->cancel();
 }
 
 }
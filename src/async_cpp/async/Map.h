@@ -1,30 +1,95 @@
 #pragma once
 #include "async_cpp/async/Async.h"
 #include "async_cpp/async/ParallelForEach.h"
+#include "async_cpp/async/detail/PhasedTask.h"
 
+#include <algorithm>
+#include <type_traits>
 #include <vector>
 
 namespace async_cpp {
 namespace async {
 
 /**
- * Filter a set of data using a criteria
+ * Map a set of data using an operation. Data is mapped in parallel chunks, writing each result directly to its index 
+ * in the output. When data and results are the same type, data is mapped in place. Element operations are called 
+ * through a std::function for each item. Only block operations, such as one made by kernel from a lambda, map a 
+ * contiguous chunk of trivially copyable data in one call, giving the compiler a loop it can inline and vectorize. 
+ * Results without a default value, and bool results, which are packed and cannot be written by index in parallel, are 
+ * collected as each is produced instead. Bool results written into a caller provided output are mapped into a buffer 
+ * per chunk, which are copied into the output once all chunks are complete.
  */
 //------------------------------------------------------------------------------
 template<class TDATA, class TRESULT>
 class Map {
 public:
     typedef typename std::function<TRESULT(const TDATA&)> map_op_t;
+    typedef typename std::function<void(const TDATA*, TRESULT*, const size_t)> block_op_t;
     typedef typename ParallelForEach<TDATA, TRESULT>::then_t then_t;
     /**
      * Create a filter operation that will filter a set of data based on an operation.
      * @param manager Manager to use with filter operation
      * @param mapOp Operation to use for filtering
      * @param data Data to be mapped
+     * @param grainSize Largest number of items mapped by a single task, chosen from the data size if zero
      */
     Map(tasks::ManagerPtr manager, 
         typename map_op_t mapOp,
-        std::vector<TDATA>&& data);
+        std::vector<TDATA>&& data,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a map operation writing into a caller provided output, without taking ownership of data. Data and output 
+     * must stay alive until the operation completes. The result set passed to the completion function is empty.
+     * @param manager Manager to use with map operation
+     * @param mapOp Operation to use for mapping
+     * @param data Data to be mapped
+     * @param output Output receiving the result for each index of data, resized if smaller than data
+     * @param grainSize Largest number of items mapped by a single task, chosen from the data size if zero
+     */
+    Map(tasks::ManagerPtr manager, 
+        typename map_op_t mapOp,
+        const std::vector<TDATA>& data,
+        std::vector<TRESULT>& output,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a map operation which maps contiguous chunks of trivially copyable data with a block operation. Neither 
+     * data nor results can be bool, and results must be default constructible.
+     * @param manager Manager to use with map operation
+     * @param blockOp Operation mapping a number of items of data into the same number of results
+     * @param data Data to be mapped
+     * @param grainSize Largest number of items mapped by a single task, chosen from the data size if zero
+     */
+    Map(tasks::ManagerPtr manager, 
+        typename block_op_t blockOp,
+        std::vector<TDATA>&& data,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a map operation which maps contiguous chunks of trivially copyable data with a block operation, writing 
+     * into a caller provided output. Neither data nor results can be bool, and results must be default constructible. 
+     * Data and output must stay alive until the operation completes.
+     * @param manager Manager to use with map operation
+     * @param blockOp Operation mapping a number of items of data into the same number of results
+     * @param data Data to be mapped
+     * @param output Output receiving the result for each index of data, resized if smaller than data
+     * @param grainSize Largest number of items mapped by a single task, chosen from the data size if zero
+     */
+    Map(tasks::ManagerPtr manager, 
+        typename block_op_t blockOp,
+        const std::vector<TDATA>& data,
+        std::vector<TRESULT>& output,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a block operation applying an element operation to each item of a chunk. The element operation is called 
+     * directly rather than through a std::function, so it can be inlined and the loop vectorized.
+     * @param elementOp Operation producing a result from an item, such as a lambda
+     * @return Block operation to map with
+     */
+    template<class TOP>
+    static block_op_t kernel(TOP elementOp);
 
     /**
      * Run the operation across the set of data, invoking a task with the mapped results
@@ -38,10 +103,53 @@ public:
     void cancel();
 
 private:
+    typedef std::shared_ptr<detail::PhasedTask<std::vector<TRESULT>>> task_ptr_t;
+    //bools are packed, so have no contiguous block to pass to a block operation
+    typedef std::integral_constant<bool, 
+        std::is_trivially_copyable<TDATA>::value && std::is_trivially_copyable<TRESULT>::value && 
+        !std::is_same<TDATA, bool>::value && !std::is_same<TRESULT, bool>::value> is_blockable_t;
+    //results can be preallocated, and written by index in parallel without touching their neighbours
+    typedef std::integral_constant<bool, 
+        std::is_default_constructible<TRESULT>::value && !std::is_same<TRESULT, bool>::value> is_indexable_t;
+
+    task_ptr_t createTask(typename then_t afterMap);
+    AsyncResult thenOutput(typename then_t afterMap, std::true_type isIndexable);
+    AsyncResult thenOutput(typename then_t afterMap, std::false_type isIndexable);
+    AsyncResult thenOwned(typename then_t afterMap, std::true_type isInPlace);
+    AsyncResult thenOwned(typename then_t afterMap, std::false_type isInPlace);
+    AsyncResult thenCollected(typename then_t afterMap, std::true_type isIndexable);
+    AsyncResult thenCollected(typename then_t afterMap, std::false_type isIndexable);
+    static void runMap(task_ptr_t task, 
+        typename map_op_t op, 
+        typename block_op_t blockOp, 
+        const std::vector<TDATA>* data, 
+        std::vector<TRESULT>* output, 
+        const size_t grainSize,
+        std::function<void(void)> next);
+    static void mapChunk(const std::vector<TDATA>& data, 
+        std::vector<TRESULT>& output, 
+        const size_t begin, 
+        const size_t end, 
+        const typename map_op_t& op, 
+        const typename block_op_t& blockOp, 
+        std::true_type isBlockable);
+    static void mapChunk(const std::vector<TDATA>& data, 
+        std::vector<TRESULT>& output, 
+        const size_t begin, 
+        const size_t end, 
+        const typename map_op_t& op, 
+        const typename block_op_t& blockOp, 
+        std::false_type isBlockable);
+
     typename map_op_t mOp;
+    typename block_op_t mBlockOp;
     tasks::ManagerPtr mManager;
     std::vector<TDATA> mData;
+    const std::vector<TDATA>* mInput;
+    std::vector<TRESULT>* mOutput;
+    size_t mGrainSize;
     std::shared_ptr<ParallelForEach<TDATA, TRESULT>> mParallel;
+    std::shared_ptr<tasks::Task> mTask;
 };
 
 //inline implementations
@@ -49,16 +157,209 @@ private:
 template<class TDATA, class TRESULT>
 Map<TDATA, TRESULT>::Map(tasks::ManagerPtr manager, 
                       typename map_op_t mapOp, 
-                      std::vector<TDATA>&& data)
-    : mManager(manager), mOp(mapOp), mData(std::move(data))
+                      std::vector<TDATA>&& data,
+                      const size_t grainSize)
+    : mManager(manager), mOp(mapOp), mData(std::move(data)), mInput(nullptr), mOutput(nullptr), mGrainSize(grainSize)
 {
+    if(!mManager) { throw(std::invalid_argument("Map: Manager cannot be null")); }
+    if(!mOp) { throw(std::invalid_argument("Map: Map operation cannot be null")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mData.size()); }
+}
 
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+Map<TDATA, TRESULT>::Map(tasks::ManagerPtr manager, 
+                      typename map_op_t mapOp, 
+                      const std::vector<TDATA>& data,
+                      std::vector<TRESULT>& output,
+                      const size_t grainSize)
+    : mManager(manager), mOp(mapOp), mInput(&data), mOutput(&output), mGrainSize(grainSize)
+{
+    if(!mManager) { throw(std::invalid_argument("Map: Manager cannot be null")); }
+    if(!mOp) { throw(std::invalid_argument("Map: Map operation cannot be null")); }
+    if(mOutput->size() < mInput->size()) { mOutput->resize(mInput->size()); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mInput->size()); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+Map<TDATA, TRESULT>::Map(tasks::ManagerPtr manager, 
+                      typename block_op_t blockOp, 
+                      std::vector<TDATA>&& data,
+                      const size_t grainSize)
+    : mManager(manager), mBlockOp(blockOp), mData(std::move(data)), mInput(nullptr), mOutput(nullptr), mGrainSize(grainSize)
+{
+    static_assert(is_blockable_t::value, "Map: Block operations require trivially copyable data and results other than bool");
+    static_assert(std::is_default_constructible<TRESULT>::value, 
+        "Map: Block operations require default constructible results to write into");
+    if(!mManager) { throw(std::invalid_argument("Map: Manager cannot be null")); }
+    if(!mBlockOp) { throw(std::invalid_argument("Map: Block operation cannot be null")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mData.size()); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+Map<TDATA, TRESULT>::Map(tasks::ManagerPtr manager, 
+                      typename block_op_t blockOp, 
+                      const std::vector<TDATA>& data,
+                      std::vector<TRESULT>& output,
+                      const size_t grainSize)
+    : mManager(manager), mBlockOp(blockOp), mInput(&data), mOutput(&output), mGrainSize(grainSize)
+{
+    static_assert(is_blockable_t::value, "Map: Block operations require trivially copyable data and results other than bool");
+    static_assert(std::is_default_constructible<TRESULT>::value, 
+        "Map: Block operations require default constructible results to write into");
+    if(!mManager) { throw(std::invalid_argument("Map: Manager cannot be null")); }
+    if(!mBlockOp) { throw(std::invalid_argument("Map: Block operation cannot be null")); }
+    if(mOutput->size() < mInput->size()) { mOutput->resize(mInput->size()); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mInput->size()); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+template<class TOP>
+typename Map<TDATA, TRESULT>::block_op_t Map<TDATA, TRESULT>::kernel(TOP elementOp)
+{
+    return [elementOp](const TDATA* data, TRESULT* output, const size_t size)->void
+    {
+        for(size_t i = 0; i < size; ++i)
+        {
+            output[i] = elementOp(data[i]);
+        }
+    };
 }
 
 //------------------------------------------------------------------------------
 template<class TDATA, class TRESULT>
 AsyncResult Map<TDATA, TRESULT>::then(typename then_t afterMap)
 {
+    if(mOutput)
+    {
+        return thenOutput(afterMap, is_indexable_t());
+    }
+    return thenOwned(afterMap, std::integral_constant<bool, 
+        std::is_same<TDATA, TRESULT>::value && is_indexable_t::value>());
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+void Map<TDATA, TRESULT>::cancel()
+{
+    if(mParallel) mParallel->cancel();
+    if(mTask) mTask->cancel();
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+typename Map<TDATA, TRESULT>::task_ptr_t Map<TDATA, TRESULT>::createTask(typename then_t afterMap)
+{
+    auto task = std::make_shared<detail::PhasedTask<std::vector<TRESULT>>>(mManager, 
+        [afterMap](std::exception_ptr ex, std::vector<TRESULT>* results)->void
+        {
+            afterMap(ex, results ? std::move(*results) : std::vector<TRESULT>());
+        } );
+    mTask = task;
+    return task;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+AsyncResult Map<TDATA, TRESULT>::thenOutput(typename then_t afterMap, std::true_type)
+{
+    auto task = createTask(afterMap);
+    auto result = task->result();
+    auto empty = std::make_shared<std::vector<TRESULT>>();
+    runMap(task, mOp, mBlockOp, mInput, mOutput, mGrainSize, [task, empty]()->void
+    {
+        task->finish(empty.get());
+    } );
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+AsyncResult Map<TDATA, TRESULT>::thenOutput(typename then_t afterMap, std::false_type)
+{
+    //only bool results reach here, as the output is resized on construction. Bools are packed, so each chunk of the input 
+    //is mapped into a buffer of its own, and the buffers are copied into the output in order once all are complete
+    auto task = createTask(afterMap);
+    auto result = task->result();
+    auto input = mInput;
+    auto output = mOutput;
+    auto op = mOp;
+    auto grainSize = mGrainSize;
+    auto nbChunks = (input->size() + grainSize - 1) / grainSize;
+    auto chunks = std::make_shared<std::vector<std::vector<TRESULT>>>(nbChunks);
+    auto mapChunks = [input, op, chunks, grainSize](const size_t begin, const size_t end)->void
+    {
+        for(size_t chunk = begin; chunk < end; ++chunk)
+        {
+            auto first = chunk * grainSize;
+            auto last = std::min(input->size(), first + grainSize);
+            auto& results = (*chunks)[chunk];
+            results.reserve(last - first);
+            for(size_t i = first; i < last; ++i)
+            {
+                results.push_back(op((*input)[i]));
+            }
+        }
+    };
+
+    task->runPhase(nbChunks, 1, mapChunks, [task, output, chunks]()->void
+    {
+        auto position = output->begin();
+        for(auto& results : *chunks)
+        {
+            position = std::copy(results.begin(), results.end(), position);
+        }
+        std::vector<TRESULT> empty;
+        task->finish(&empty);
+    } );
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+AsyncResult Map<TDATA, TRESULT>::thenOwned(typename then_t afterMap, std::true_type)
+{
+    //results overwrite the data they were mapped from
+    auto task = createTask(afterMap);
+    auto result = task->result();
+    auto data = std::make_shared<std::vector<TDATA>>(std::move(mData));
+    runMap(task, mOp, mBlockOp, data.get(), data.get(), mGrainSize, [task, data]()->void
+    {
+        task->finish(data.get());
+    } );
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+AsyncResult Map<TDATA, TRESULT>::thenOwned(typename then_t afterMap, std::false_type)
+{
+    return thenCollected(afterMap, is_indexable_t());
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+AsyncResult Map<TDATA, TRESULT>::thenCollected(typename then_t afterMap, std::true_type)
+{
+    auto task = createTask(afterMap);
+    auto result = task->result();
+    auto data = std::make_shared<std::vector<TDATA>>(std::move(mData));
+    auto results = std::make_shared<std::vector<TRESULT>>(data->size());
+    runMap(task, mOp, mBlockOp, data.get(), results.get(), mGrainSize, [task, data, results]()->void
+    {
+        task->finish(results.get());
+    } );
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+AsyncResult Map<TDATA, TRESULT>::thenCollected(typename then_t afterMap, std::false_type)
+{
+    //results without a default value or packed as bools cannot be preallocated, so are collected as each is produced
     auto mapOpCopy(mOp);
     auto op = [mapOpCopy](const TDATA& value, typename ParallelForEach<TRESULT>::callback_t cb) -> void {
         cb(mapOpCopy(value));
@@ -69,9 +370,54 @@ AsyncResult Map<TDATA, TRESULT>::then(typename then_t afterMap)
 
 //------------------------------------------------------------------------------
 template<class TDATA, class TRESULT>
-void Map<TDATA, TRESULT>::cancel()
+void Map<TDATA, TRESULT>::runMap(task_ptr_t task, 
+    typename map_op_t op, 
+    typename block_op_t blockOp, 
+    const std::vector<TDATA>* data, 
+    std::vector<TRESULT>* output, 
+    const size_t grainSize,
+    std::function<void(void)> next)
 {
-    if(mParallel) mParallel->cancel();
+    auto mapChunks = [op, blockOp, data, output](const size_t begin, const size_t end)->void
+    {
+        mapChunk(*data, *output, begin, end, op, blockOp, is_blockable_t());
+    };
+    task->runPhase(data->size(), grainSize, mapChunks, next);
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+void Map<TDATA, TRESULT>::mapChunk(const std::vector<TDATA>& data, 
+    std::vector<TRESULT>& output, 
+    const size_t begin, 
+    const size_t end, 
+    const typename map_op_t& op, 
+    const typename block_op_t& blockOp, 
+    std::true_type)
+{
+    //element operations map item by item
+    if(!blockOp)
+    {
+        mapChunk(data, output, begin, end, op, blockOp, std::false_type());
+        return;
+    }
+    blockOp(data.data() + begin, output.data() + begin, end - begin);
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+void Map<TDATA, TRESULT>::mapChunk(const std::vector<TDATA>& data, 
+    std::vector<TRESULT>& output, 
+    const size_t begin, 
+    const size_t end, 
+    const typename map_op_t& op, 
+    const typename block_op_t&, 
+    std::false_type)
+{
+    for(size_t i = begin; i < end; ++i)
+    {
+        output[i] = op(data[i]);
+    }
 }
 
 }
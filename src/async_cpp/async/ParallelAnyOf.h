@@ -0,0 +1,61 @@
+#pragma once
+#include "async_cpp/async/detail/Search.h"
+
+#include <iterator>
+#include <type_traits>
+
+namespace async_cpp {
+namespace async {
+
+/**
+ * Check if any item of a set of data passes a criteria, searching chunks of data in parallel. Once any match is 
+ * found, remaining chunks stop early and chunks not yet run skip their data. Data is searched in place, 
+ * and must stay alive until the operation completes.
+ */
+//------------------------------------------------------------------------------
+template<class TDATA>
+class ParallelAnyOf : public detail::IndexSearch<bool> {
+public:
+    typedef typename std::function<bool(const TDATA&)> predicate_t;
+
+    /**
+     * Create a parallel check of data between random access iterators.
+     * @param manager Manager to run tasks against
+     * @param predicate Criteria returning true for a matching item
+     * @param begin Iterator to first item of data
+     * @param end Iterator past last item of data
+     * @param grainSize Largest number of items checked by a single task, chosen from the data size if zero
+     */
+    template<class TITERATOR>
+    ParallelAnyOf(tasks::ManagerPtr manager, 
+        typename predicate_t predicate,
+        TITERATOR begin,
+        TITERATOR end,
+        const size_t grainSize = 0);
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TDATA>
+template<class TITERATOR>
+ParallelAnyOf<TDATA>::ParallelAnyOf(tasks::ManagerPtr manager, 
+        typename predicate_t predicate,
+        TITERATOR begin,
+        TITERATOR end,
+        const size_t grainSize)
+    : detail::IndexSearch<bool>(manager, 
+        [predicate, begin](const size_t index)->bool { return predicate(begin[index]); }, 
+        static_cast<size_t>(std::distance(begin, end)), 
+        grainSize, 
+        false, 
+        [](const size_t index)->bool { return index != detail::NOT_FOUND; })
+{
+    static_assert(std::is_base_of<std::random_access_iterator_tag, 
+        typename std::iterator_traits<TITERATOR>::iterator_category>::value, 
+        "ParallelAnyOf: Iterators must be random access");
+    if(!manager) { throw(std::invalid_argument("ParallelAnyOf: Manager cannot be null")); }
+    if(!predicate) { throw(std::invalid_argument("ParallelAnyOf: Predicate cannot be null")); }
+}
+
+}
+}
\ No newline at end of file
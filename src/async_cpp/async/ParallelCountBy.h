@@ -0,0 +1,81 @@
+#pragma once
+#include "async_cpp/async/ParallelGroupBy.h"
+
+namespace async_cpp {
+namespace async {
+
+/**
+ * Count a set of data by hashed key in parallel, passing the count of each key to the completion function. Counting 
+ * is a group by aggregating into a count per key, so blocks count into their own local hash tables per key partition, 
+ * and partitions merge their counts in parallel, without any table being shared or locked between tasks.
+ */
+//------------------------------------------------------------------------------
+template<class TDATA, class TKEY>
+class ParallelCountBy {
+public:
+    typedef typename ParallelGroupBy<TDATA, TKEY, size_t>::key_op_t key_op_t;
+    typedef typename ParallelGroupBy<TDATA, TKEY, size_t>::result_t result_t;
+    typedef typename ParallelGroupBy<TDATA, TKEY, size_t>::then_t then_t;
+
+    /**
+     * Create a parallel count of data by key.
+     * @param manager Manager to run tasks against
+     * @param keyOp Operation producing the key of a data item
+     * @param data Data to count
+     * @param grainSize Number of items in each block, chosen from the data size if zero
+     */
+    ParallelCountBy(tasks::ManagerPtr manager, 
+        typename key_op_t keyOp,
+        std::vector<TDATA>&& data,
+        const size_t grainSize = 0);
+
+    /**
+     * Count the set of data, invoking a task with the count of each key
+     * @param onFinishTask Task to run when all data has been counted
+     * @return AsyncResult that holds a future completion status, either successful or exception
+     */
+    AsyncResult then(typename then_t onFinishTask);
+
+    /**
+     * Cancel outstanding tasks
+     */
+    void cancel();
+
+private:
+    ParallelGroupBy<TDATA, TKEY, size_t> mGroupBy;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TDATA, class TKEY>
+ParallelCountBy<TDATA, TKEY>::ParallelCountBy(tasks::ManagerPtr manager, 
+        typename key_op_t keyOp,
+        std::vector<TDATA>&& data,
+        const size_t grainSize)
+    : mGroupBy(manager, 
+        keyOp, 
+        0, 
+        [](size_t& count, TDATA&&)->void { ++count; }, 
+        [](size_t& count, size_t&& other)->void { count += other; }, 
+        std::move(data), 
+        grainSize)
+{
+
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TKEY>
+AsyncResult ParallelCountBy<TDATA, TKEY>::then(typename then_t onFinishOp)
+{
+    return mGroupBy.then(onFinishOp);
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TKEY>
+void ParallelCountBy<TDATA, TKEY>::cancel()
+{
+    mGroupBy.cancel();
+}
+
+}
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+#include "async_cpp/async/detail/Search.h"
+
+#include <iterator>
+#include <type_traits>
+
+namespace async_cpp {
+namespace async {
+
+/**
+ * Find the first item of a set of data which passes a criteria, searching chunks of data in parallel. Once a match is 
+ * found, chunks after it stop early and chunks not yet run skip their data. The index of the match is passed to the 
+ * completion function, or NOT_FOUND if no item matched. Data is searched in place, and must stay alive until the 
+ * operation completes.
+ */
+//------------------------------------------------------------------------------
+template<class TDATA>
+class ParallelFind : public detail::IndexSearch<size_t> {
+public:
+    typedef typename std::function<bool(const TDATA&)> predicate_t;
+    static constexpr size_t NOT_FOUND = detail::NOT_FOUND;
+
+    /**
+     * Create a parallel search of data between random access iterators.
+     * @param manager Manager to run tasks against
+     * @param predicate Criteria returning true for a matching item
+     * @param begin Iterator to first item of data
+     * @param end Iterator past last item of data
+     * @param grainSize Largest number of items searched by a single task, chosen from the data size if zero
+     */
+    template<class TITERATOR>
+    ParallelFind(tasks::ManagerPtr manager, 
+        typename predicate_t predicate,
+        TITERATOR begin,
+        TITERATOR end,
+        const size_t grainSize = 0);
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TDATA>
+constexpr size_t ParallelFind<TDATA>::NOT_FOUND;
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+template<class TITERATOR>
+ParallelFind<TDATA>::ParallelFind(tasks::ManagerPtr manager, 
+        typename predicate_t predicate,
+        TITERATOR begin,
+        TITERATOR end,
+        const size_t grainSize)
+    : detail::IndexSearch<size_t>(manager, 
+        [predicate, begin](const size_t index)->bool { return predicate(begin[index]); }, 
+        static_cast<size_t>(std::distance(begin, end)), 
+        grainSize, 
+        true, 
+        [](const size_t index)->size_t { return index; })
+{
+    static_assert(std::is_base_of<std::random_access_iterator_tag, 
+        typename std::iterator_traits<TITERATOR>::iterator_category>::value, 
+        "ParallelFind: Iterators must be random access");
+    if(!manager) { throw(std::invalid_argument("ParallelFind: Manager cannot be null")); }
+    if(!predicate) { throw(std::invalid_argument("ParallelFind: Predicate cannot be null")); }
+}
+
+}
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#pragma once
+#include "async_cpp/async/detail/PhasedTask.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace async_cpp {
+namespace async {
+
+/**
+ * Map each item of a set of data to zero or more results, such as tokenising text or expanding records, passing all
+ * results to the completion function in the order of the data they came from. Data is split into blocks, and each block
+ * appends the results of its items to its own buffer in parallel. Buffer sizes are then scanned into output offsets, and
+ * each block moves its buffer into a preallocated output in parallel. Results must be default constructible.
+ */
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+class ParallelFlatMap {
+public:
+    typedef typename std::function<void(const TDATA&, std::vector<TRESULT>&)> flat_map_op_t;
+    typedef typename std::function<void(std::exception_ptr, std::vector<TRESULT>&&)> then_t;
+
+    /**
+     * Create a flat map operation over a set of data.
+     * @param manager Manager to run tasks against
+     * @param flatMapOp Operation appending the results of an item to a buffer, which may already hold results of earlier
+     * items that must be left in place
+     * @param data Data to be mapped
+     * @param grainSize Number of items in each block, chosen from the data size if zero
+     */
+    ParallelFlatMap(tasks::ManagerPtr manager,
+        typename flat_map_op_t flatMapOp,
+        std::vector<TDATA>&& data,
+        const size_t grainSize = 0);
+
+    /**
+     * Run the operation across the set of data, invoking a task with all results
+     * @param afterMap Function to invoke when flat map operation is complete, receiving results in data order
+     * @return AsyncResult that holds a future completion status, either successful or exception
+     */
+    AsyncResult then(typename then_t afterMap);
+
+    /**
+     * Cancel outstanding tasks
+     */
+    void cancel();
+
+private:
+    typename flat_map_op_t mOp;
+    tasks::ManagerPtr mManager;
+    std::shared_ptr<std::vector<TDATA>> mData;
+    size_t mGrainSize;
+    std::shared_ptr<tasks::Task> mTask;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+ParallelFlatMap<TDATA, TRESULT>::ParallelFlatMap(tasks::ManagerPtr manager,
+        typename flat_map_op_t flatMapOp,
+        std::vector<TDATA>&& data,
+        const size_t grainSize)
+    : mOp(flatMapOp),
+      mManager(manager),
+      mData(std::make_shared<std::vector<TDATA>>(std::move(data))),
+      mGrainSize(grainSize)
+{
+    if(!mManager) { throw(std::invalid_argument("ParallelFlatMap: Manager cannot be null")); }
+    if(!mOp) { throw(std::invalid_argument("ParallelFlatMap: Flat map operation cannot be null")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mData->size()); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+AsyncResult ParallelFlatMap<TDATA, TRESULT>::then(typename then_t afterMap)
+{
+    auto task = std::make_shared<detail::PhasedTask<std::vector<TRESULT>>>(mManager,
+        [afterMap](std::exception_ptr ex, std::vector<TRESULT>* results)->void
+        {
+            afterMap(ex, results ? std::move(*results) : std::vector<TRESULT>());
+        } );
+    mTask = task;
+    auto result = task->result();
+
+    auto data = mData;
+    auto flatMapOp = mOp;
+    auto grainSize = mGrainSize;
+    auto nbBlocks = (data->size() + grainSize - 1) / grainSize;
+    auto buffers = std::make_shared<std::vector<std::vector<TRESULT>>>(nbBlocks);
+    auto mapBlocks = [data, flatMapOp, buffers, grainSize](const size_t begin, const size_t end)->void
+    {
+        for(size_t block = begin; block < end; ++block)
+        {
+            auto& buffer = (*buffers)[block];
+            auto last = std::min(data->size(), (block + 1) * grainSize);
+            for(size_t i = block * grainSize; i < last; ++i)
+            {
+                flatMapOp((*data)[i], buffer);
+            }
+        }
+    };
+
+    task->runPhase(nbBlocks, 1, mapBlocks, [task, buffers]()->void
+    {
+        auto offsets = std::make_shared<std::vector<size_t>>(buffers->size());
+        size_t total = 0;
+        for(size_t block = 0; block < buffers->size(); ++block)
+        {
+            (*offsets)[block] = total;
+            total += (*buffers)[block].size();
+        }
+
+        auto output = std::make_shared<std::vector<TRESULT>>(total);
+        auto moveBuffers = [buffers, offsets, output](const size_t begin, const size_t end)->void
+        {
+            for(size_t block = begin; block < end; ++block)
+            {
+                auto& buffer = (*buffers)[block];
+                std::move(buffer.begin(), buffer.end(), output->begin() + (*offsets)[block]);
+                std::vector<TRESULT>().swap(buffer);
+            }
+        };
+
+        task->runPhase(buffers->size(), 1, moveBuffers, [task, output]()->void
+        {
+            task->finish(output.get());
+        } );
+    } );
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+void ParallelFlatMap<TDATA, TRESULT>::cancel()
+{
+    if(mTask) mTask->cancel();
+}
+
+}
+}
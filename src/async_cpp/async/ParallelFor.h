@@ -1,12 +1,16 @@
 #pragma once
 #include "async_cpp/async/detail/ParallelTask.h"
+#include "async_cpp/async/detail/RangeTask.h"
+
+#include <chrono>
 
 namespace async_cpp {
 namespace async {
 
 /**
  * Perform an operation in parallel for a number of times, optionally calling a function to examine all results once parallel 
- * operations are complete. Each task will be passed an index as data.
+ * operations are complete. Each task will be passed an index as data, or a chunk of indices when a grain size or target 
+ * chunk duration is given.
  */
 //------------------------------------------------------------------------------
 template<class TDATA>
@@ -14,6 +18,7 @@ class ParallelFor {
 public:
     typedef std::function<void(const size_t, typename detail::ParallelTask<TDATA>::callback_t)> operation_t;
     typedef typename detail::ParallelTask<TDATA>::callback_t callback_t;
+    typedef typename detail::RangeTask<TDATA>::operation_t range_operation_t;
     typedef typename detail::ParallelCollectTask<TDATA>::then_t then_t;
     typedef typename detail::ParallelCollectTask<TDATA>::result_set_t result_set_t;
     /**
@@ -26,6 +31,35 @@ public:
         typename operation_t op, 
         const size_t nbTimes);
 
+    /**
+     * Create a parallel task set which passes chunks of indices [begin, end) to each task. Chunks are split in half 
+     * until no larger than the grain size, with each half queued so idle workers can take it. One result is collected 
+     * per chunk, in index order.
+     * @param manager Manager to run tasks against
+     * @param op Operation to run for each chunk of indices
+     * @param nbTimes Total number of indices to run operation for
+     * @param grainSize Largest number of indices passed to a single operation
+     */
+    ParallelFor(tasks::ManagerPtr manager, 
+        range_operation_t op, 
+        const size_t nbTimes,
+        const size_t grainSize);
+
+    /**
+     * Create a parallel task set which passes chunks of indices [begin, end) to each task, sized adaptively. Each chunk 
+     * is timed and later chunks grown or shrunk towards the target duration, so no grain size needs to be chosen. Ranges 
+     * only split off another half for idle workers once earlier halves have been taken. One result is collected per 
+     * chunk, in index order.
+     * @param manager Manager to run tasks against
+     * @param op Operation to run for each chunk of indices
+     * @param nbTimes Total number of indices to run operation for
+     * @param targetDuration Duration each chunk should take to run
+     */
+    ParallelFor(tasks::ManagerPtr manager, 
+        range_operation_t op, 
+        const size_t nbTimes,
+        const std::chrono::nanoseconds targetDuration);
+
     /**
      * Run the operation across the set of data, invoking a task with the result of the data
      * @param onFinishTask Task to run when operation has been applied to all data
@@ -40,9 +74,12 @@ public:
 
 private:
     typename operation_t mOp;
+    range_operation_t mRangeOp;
     tasks::ManagerPtr mManager;
     std::vector<std::shared_ptr<detail::IParallelTask<TDATA>>> mTasks;
+    std::shared_ptr<detail::AdaptivePartitioner> mPartitioner;
     size_t mNbTimes;
+    size_t mGrainSize;
 };
 
 //inline implementations
@@ -51,18 +88,57 @@ template<class TDATA>
 ParallelFor<TDATA>::ParallelFor(tasks::ManagerPtr manager, 
         typename operation_t op, 
         const size_t nbTimes)
-    : mManager(manager), mOp(op), mNbTimes(nbTimes)
+    : mManager(manager), mOp(op), mNbTimes(nbTimes), mGrainSize(0)
 {
     if(!mManager) { throw(std::invalid_argument("ParallelFor: Manager cannot be null")); }
     if(0 == mNbTimes) { throw(std::invalid_argument("ParallelFor: At least one iteration required")); }
     
 }
 
+//------------------------------------------------------------------------------
+template<class TDATA>
+ParallelFor<TDATA>::ParallelFor(tasks::ManagerPtr manager, 
+        range_operation_t op, 
+        const size_t nbTimes,
+        const size_t grainSize)
+    : mManager(manager), mRangeOp(op), mNbTimes(nbTimes), mGrainSize(grainSize)
+{
+    if(!mManager) { throw(std::invalid_argument("ParallelFor: Manager cannot be null")); }
+    if(0 == mNbTimes) { throw(std::invalid_argument("ParallelFor: At least one iteration required")); }
+    if(0 == mGrainSize) { throw(std::invalid_argument("ParallelFor: Grain size must be at least one")); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+ParallelFor<TDATA>::ParallelFor(tasks::ManagerPtr manager, 
+        range_operation_t op, 
+        const size_t nbTimes,
+        const std::chrono::nanoseconds targetDuration)
+    : mManager(manager), mRangeOp(op), mNbTimes(nbTimes), mGrainSize(1)
+{
+    if(!mManager) { throw(std::invalid_argument("ParallelFor: Manager cannot be null")); }
+    if(0 == mNbTimes) { throw(std::invalid_argument("ParallelFor: At least one iteration required")); }
+    if(targetDuration.count() <= 0) { throw(std::invalid_argument("ParallelFor: Target duration must be positive")); }
+    mPartitioner = std::make_shared<detail::AdaptivePartitioner>(targetDuration);
+}
+
 //------------------------------------------------------------------------------
 template<class TDATA>
 AsyncResult ParallelFor<TDATA>::then(typename detail::ParallelCollectTask<TDATA>::then_t onFinishOp )
 {
     auto terminalTask(std::make_shared<detail::ParallelCollectTask<TDATA>>(mManager, mNbTimes, onFinishOp));
+    if(mRangeOp)
+    {
+        //a single task covers all indices, splitting itself as it runs
+        auto task = std::make_shared<detail::RangeTask<TDATA>>(mManager, mRangeOp, 
+            detail::BlockedRange(0, mNbTimes, mGrainSize), terminalTask, mPartitioner);
+        mTasks.emplace_back(terminalTask);
+        mTasks.emplace_back(task);
+        auto result = terminalTask->result();
+        mManager->run(task);
+        return result;
+    }
+
     mTasks.reserve(mNbTimes + 1);
     mTasks.emplace_back(terminalTask);
 
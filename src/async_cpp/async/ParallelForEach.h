@@ -1,11 +1,24 @@
 #pragma once
 #include "async_cpp/async/detail/ParallelTask.h"
+#include "async_cpp/async/detail/RangeTask.h"
+#include "async_cpp/async/detail/ValueVisitor.h"
+
+#include <boost/variant.hpp>
+
+#include <chrono>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
 
 namespace async_cpp {
 namespace async {
 
 /**
  * Perform an operation in parallel against all data in a vector, optionally calling a function to examine all results once parallel operations are complete.
+ * Data can also be operated on in place through random access iterators or a pointer and size, without copying it into a vector.
+ * In place data is split into chunks by a grain size, or sized adaptively towards a target chunk duration. Each chunk gathers 
+ * the results of its data and reports them together, so an in place operation must invoke its callback before returning, 
+ * passing an AsyncResult for any work it continues asynchronously.
  */
 //------------------------------------------------------------------------------
 template<class TDATA, class TRESULT=TDATA>
@@ -24,6 +37,68 @@ public:
         typename operation_t op, 
         std::vector<TDATA>&& data);
 
+    /**
+     * Create a parallel task set operating in place on data between random access iterators. Data is split into chunks, 
+     * and each chunk runs the operation against its data by reference. Data must stay alive until the operation completes.
+     * @param manager Manager to run tasks against
+     * @param op Operation to run against each item of data
+     * @param begin Iterator to first item of data
+     * @param end Iterator past last item of data
+     * @param grainSize Largest number of items operated on by a single task, chosen from the data size if zero
+     */
+    template<class TITERATOR>
+    ParallelForEach(tasks::ManagerPtr manager, 
+        typename operation_t op, 
+        TITERATOR begin,
+        TITERATOR end,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a parallel task set operating in place on data between random access iterators, with chunks timed and 
+     * sized adaptively towards a target duration. Data must stay alive until the operation completes.
+     * @param manager Manager to run tasks against
+     * @param op Operation to run against each item of data
+     * @param begin Iterator to first item of data
+     * @param end Iterator past last item of data
+     * @param targetDuration Duration each chunk should take to run
+     */
+    template<class TITERATOR>
+    ParallelForEach(tasks::ManagerPtr manager, 
+        typename operation_t op, 
+        TITERATOR begin,
+        TITERATOR end,
+        const std::chrono::nanoseconds targetDuration);
+
+    /**
+     * Create a parallel task set operating in place on a contiguous span of data. Data must stay alive until the 
+     * operation completes.
+     * @param manager Manager to run tasks against
+     * @param op Operation to run against each item of data
+     * @param data First item of data
+     * @param size Number of items of data
+     * @param grainSize Largest number of items operated on by a single task, chosen from the data size if zero
+     */
+    ParallelForEach(tasks::ManagerPtr manager, 
+        typename operation_t op, 
+        TDATA* data,
+        const size_t size,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a parallel task set operating in place on a contiguous span of data, with chunks timed and sized 
+     * adaptively towards a target duration. Data must stay alive until the operation completes.
+     * @param manager Manager to run tasks against
+     * @param op Operation to run against each item of data
+     * @param data First item of data
+     * @param size Number of items of data
+     * @param targetDuration Duration each chunk should take to run
+     */
+    ParallelForEach(tasks::ManagerPtr manager, 
+        typename operation_t op, 
+        TDATA* data,
+        const size_t size,
+        const std::chrono::nanoseconds targetDuration);
+
     /**
      * Run the operation across the set of data, invoking a task with the result of the data
      * @param onFinishTask Task to run when operation has been applied to all data
@@ -37,10 +112,19 @@ public:
     void cancel();
 
 private:
+    typedef typename detail::RangeTask<result_set_t>::operation_t chunk_operation_t;
+
+    template<class TITERATOR>
+    static chunk_operation_t chunkOperation(typename operation_t op, TITERATOR data);
+
     typename operation_t mOp;
     tasks::ManagerPtr mManager;
-    std::vector<std::shared_ptr<detail::IParallelTask<TRESULT>>> mTasks;
+    std::vector<std::shared_ptr<tasks::Task>> mTasks;
     std::vector<TDATA> mData;
+    chunk_operation_t mChunkOp;
+    std::shared_ptr<detail::AdaptivePartitioner> mPartitioner;
+    size_t mSize;
+    size_t mGrainSize;
 };
 
 //inline implementations
@@ -49,16 +133,106 @@ template<class TDATA, class TRESULT>
 ParallelForEach<TDATA, TRESULT>::ParallelForEach(tasks::ManagerPtr manager, 
         typename operation_t op, 
         std::vector<TDATA>&& data)
-    : mManager(manager), mData(std::move(data)), mOp(op)
+    : mManager(manager), mData(std::move(data)), mOp(op), mSize(0), mGrainSize(0)
 {
     if(!mManager) { throw(std::invalid_argument("ParallelForEach: Manager cannot be null")); }
     if(mData.empty()) { throw(std::invalid_argument("ParallelForEach: Data cannot be empty")); }    
 }
 
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+template<class TITERATOR>
+ParallelForEach<TDATA, TRESULT>::ParallelForEach(tasks::ManagerPtr manager, 
+        typename operation_t op, 
+        TITERATOR begin,
+        TITERATOR end,
+        const size_t grainSize)
+    : mManager(manager), mOp(op), mSize(static_cast<size_t>(std::distance(begin, end))), mGrainSize(grainSize)
+{
+    static_assert(std::is_base_of<std::random_access_iterator_tag, 
+        typename std::iterator_traits<TITERATOR>::iterator_category>::value, 
+        "ParallelForEach: Iterators must be random access");
+    if(!mManager) { throw(std::invalid_argument("ParallelForEach: Manager cannot be null")); }
+    if(0 == mSize) { throw(std::invalid_argument("ParallelForEach: Data cannot be empty")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mSize); }
+    mChunkOp = chunkOperation(mOp, begin);
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+template<class TITERATOR>
+ParallelForEach<TDATA, TRESULT>::ParallelForEach(tasks::ManagerPtr manager, 
+        typename operation_t op, 
+        TITERATOR begin,
+        TITERATOR end,
+        const std::chrono::nanoseconds targetDuration)
+    : ParallelForEach(manager, op, begin, end, 1)
+{
+    mPartitioner = std::make_shared<detail::AdaptivePartitioner>(targetDuration);
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+ParallelForEach<TDATA, TRESULT>::ParallelForEach(tasks::ManagerPtr manager, 
+        typename operation_t op, 
+        TDATA* data,
+        const size_t size,
+        const size_t grainSize)
+    : mManager(manager), mOp(op), mSize(size), mGrainSize(grainSize)
+{
+    if(!mManager) { throw(std::invalid_argument("ParallelForEach: Manager cannot be null")); }
+    if(!data || 0 == mSize) { throw(std::invalid_argument("ParallelForEach: Data cannot be empty")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mSize); }
+    mChunkOp = chunkOperation(mOp, data);
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+ParallelForEach<TDATA, TRESULT>::ParallelForEach(tasks::ManagerPtr manager, 
+        typename operation_t op, 
+        TDATA* data,
+        const size_t size,
+        const std::chrono::nanoseconds targetDuration)
+    : ParallelForEach(manager, op, data, size, 1)
+{
+    mPartitioner = std::make_shared<detail::AdaptivePartitioner>(targetDuration);
+}
+
 //------------------------------------------------------------------------------
 template<class TDATA, class TRESULT>
 AsyncResult ParallelForEach<TDATA, TRESULT>::then(typename detail::ParallelCollectTask<TRESULT>::then_t onFinishOp)
 {
+    if(mChunkOp)
+    {
+        //chunks of results are collected in order, weighted by chunk size, then joined into one result set
+        auto terminalTask(std::make_shared<detail::ParallelCollectTask<result_set_t>>(mManager, mSize, 
+            [onFinishOp](std::exception_ptr ex, std::vector<result_set_t>&& chunks)->void
+            {
+                result_set_t results;
+                if(!ex)
+                {
+                    size_t total = 0;
+                    for(auto& chunk : chunks)
+                    {
+                        total += chunk.size();
+                    }
+                    results.reserve(total);
+                    for(auto& chunk : chunks)
+                    {
+                        std::move(chunk.begin(), chunk.end(), std::back_inserter(results));
+                    }
+                }
+                onFinishOp(ex, std::move(results));
+            } ));
+        auto task = std::make_shared<detail::RangeTask<result_set_t>>(mManager, mChunkOp, 
+            detail::BlockedRange(0, mSize, mGrainSize), terminalTask, mPartitioner);
+        mTasks.emplace_back(terminalTask);
+        mTasks.emplace_back(task);
+        auto result = terminalTask->result();
+        mManager->run(task);
+        return result;
+    }
+
     auto terminalTask(std::make_shared<detail::ParallelCollectTask<TRESULT>>(mManager, mData.size(), onFinishOp));
     mTasks.reserve(mData.size() + 1);
     mTasks.emplace_back(terminalTask);
@@ -80,6 +254,42 @@ AsyncResult ParallelForEach<TDATA, TRESULT>::then(typename detail::ParallelColle
     return result;
 }
 
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+template<class TITERATOR>
+typename ParallelForEach<TDATA, TRESULT>::chunk_operation_t ParallelForEach<TDATA, TRESULT>::chunkOperation(
+    typename operation_t op, 
+    TITERATOR data)
+{
+    return [op, data](const size_t begin, const size_t end, typename detail::RangeTask<result_set_t>::callback_t cb)->void
+    {
+        //results are gathered locally and reported once, rather than locking the collect task for each item
+        result_set_t results;
+        size_t nbReported = 0;
+        callback_t gather = [&results, &nbReported](typename detail::IParallelTask<TRESULT>::VariantType&& result)->void
+        {
+            ++nbReported;
+            //finished AsyncResults add no result, pending ones are waited on and exceptions fail the chunk
+            detail::ValueVisitor<TRESULT> getValue;
+            auto value = boost::apply_visitor(getValue, result);
+            if(value)
+            {
+                results.push_back(std::move(*value));
+            }
+        };
+
+        for(size_t i = begin; i < end; ++i)
+        {
+            op(data[i], gather);
+            if(nbReported != i + 1 - begin)
+            {
+                throw(std::runtime_error("ParallelForEach: In place operation returned without reporting a result"));
+            }
+        }
+        cb(std::move(results));
+    };
+}
+
 //------------------------------------------------------------------------------
 template<class TDATA, class TRESULT>
 void ParallelForEach<TDATA, TRESULT>::cancel()
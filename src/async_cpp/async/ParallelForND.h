@@ -0,0 +1,209 @@
+#pragma once
+#include "async_cpp/async/detail/RangeTask.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace async_cpp {
+namespace async {
+
+/**
+ * Order in which tiles of a multi-dimensional ParallelFor are formed and run.
+ */
+enum class TileOrder {
+    Split,  //tiles are split recursively along their longest dimension, with halves queued for idle workers
+    Morton  //tiles of the tile size are run in Morton (Z-order) chunks, so each task covers spatially close tiles
+};
+
+/**
+ * Perform an operation in parallel over tiles of a multi-dimensional set of indices, such as the pixels of an image or 
+ * the cells of a matrix, optionally calling a function to examine all results once parallel operations are complete. 
+ * Each operation is passed a tile holding a blocked range of indices per dimension, no larger than the tile size in 
+ * any dimension, so each task works on a cache resident block rather than a single row. One result is collected per 
+ * tile, in row major order of the first index of each tile.
+ */
+//------------------------------------------------------------------------------
+template<class TDATA, size_t DIMS>
+class ParallelForND {
+public:
+    typedef detail::BlockedTile<DIMS> tile_t;
+    typedef detail::RangeTask<TDATA, tile_t> tile_task_t;
+    typedef typename tile_task_t::callback_t callback_t;
+    typedef typename tile_task_t::operation_t operation_t;
+    typedef typename detail::ParallelCollectTask<TDATA>::then_t then_t;
+    typedef typename detail::ParallelCollectTask<TDATA>::result_set_t result_set_t;
+
+    /**
+     * Create a parallel task set over tiles of a multi-dimensional set of indices.
+     * @param manager Manager to run tasks against
+     * @param op Operation to run for each tile
+     * @param extents Size of each dimension, the last dimension being contiguous
+     * @param tileSizes Largest size of a tile in each dimension
+     * @param order Order in which tiles are formed and run
+     */
+    ParallelForND(tasks::ManagerPtr manager, 
+        typename operation_t op, 
+        const std::array<size_t, DIMS>& extents,
+        const std::array<size_t, DIMS>& tileSizes,
+        const TileOrder order = TileOrder::Split);
+
+    /**
+     * Run the operation across all tiles, invoking a task with the results of the tiles
+     * @param onFinishTask Task to run when operation has been applied to all tiles
+     * @return AsyncResult that holds a future completion status, either successful or exception
+     */
+    AsyncResult then(typename then_t onFinishTask);
+
+    /**
+     * Cancel outstanding tasks
+     */
+    void cancel();
+
+private:
+    tile_t wholeTile() const;
+    std::vector<tile_t> mortonTiles() const;
+
+    typename operation_t mOp;
+    tasks::ManagerPtr mManager;
+    std::array<size_t, DIMS> mExtents;
+    std::array<size_t, DIMS> mTileSizes;
+    TileOrder mOrder;
+    std::vector<std::shared_ptr<detail::IParallelTask<TDATA>>> mTasks;
+};
+
+/**
+ * Perform an operation in parallel over tiles of rows and columns.
+ */
+template<class TDATA>
+using ParallelFor2D = ParallelForND<TDATA, 2>;
+
+/**
+ * Perform an operation in parallel over tiles of a three dimensional set of indices.
+ */
+template<class TDATA>
+using ParallelFor3D = ParallelForND<TDATA, 3>;
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TDATA, size_t DIMS>
+ParallelForND<TDATA, DIMS>::ParallelForND(tasks::ManagerPtr manager, 
+        typename operation_t op, 
+        const std::array<size_t, DIMS>& extents,
+        const std::array<size_t, DIMS>& tileSizes,
+        const TileOrder order)
+    : mOp(op), mManager(manager), mExtents(extents), mTileSizes(tileSizes), mOrder(order)
+{
+    if(!mManager) { throw(std::invalid_argument("ParallelForND: Manager cannot be null")); }
+    if(!mOp) { throw(std::invalid_argument("ParallelForND: Operation cannot be null")); }
+    for(size_t dimension = 0; dimension < DIMS; ++dimension)
+    {
+        if(0 == mExtents[dimension]) { throw(std::invalid_argument("ParallelForND: At least one iteration required")); }
+        if(0 == mTileSizes[dimension]) { throw(std::invalid_argument("ParallelForND: Tile size must be at least one")); }
+    }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, size_t DIMS>
+AsyncResult ParallelForND<TDATA, DIMS>::then(typename then_t onFinishOp)
+{
+    auto whole = wholeTile();
+    auto terminalTask(std::make_shared<detail::ParallelCollectTask<TDATA>>(mManager, whole.size(), onFinishOp));
+    auto result = terminalTask->result();
+    mTasks.emplace_back(terminalTask);
+
+    if(TileOrder::Split == mOrder)
+    {
+        //a single task covers all indices, splitting itself as it runs
+        auto task = std::make_shared<tile_task_t>(mManager, mOp, whole, terminalTask, 
+            std::shared_ptr<detail::AdaptivePartitioner>(), typename tile_task_t::adapter_t(mExtents));
+        mTasks.emplace_back(task);
+        mManager->run(task);
+        return result;
+    }
+
+    //chunks of morton ordered tiles, where each tile reports its own result
+    auto tiles = std::make_shared<std::vector<tile_t>>(mortonTiles());
+    auto op = mOp;
+    auto extents = mExtents;
+    auto rangeOp = [tiles, op, extents, terminalTask](const size_t begin, const size_t end, callback_t)->void
+    {
+        for(size_t i = begin; i < end; ++i)
+        {
+            const auto& tile = (*tiles)[i];
+            auto index = tile.index(extents);
+            auto size = tile.size();
+            op(tile, [terminalTask, index, size](typename detail::IParallelTask<TDATA>::VariantType&& result)->void
+            {
+                terminalTask->notifyCompletion(index, std::move(result), size);
+            } );
+        }
+    };
+    auto task = std::make_shared<detail::RangeTask<TDATA>>(mManager, rangeOp, 
+        detail::BlockedRange(0, tiles->size(), detail::BlockedRange::defaultGrainSize(tiles->size())), terminalTask);
+    mTasks.emplace_back(task);
+    mManager->run(task);
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, size_t DIMS>
+void ParallelForND<TDATA, DIMS>::cancel()
+{
+    for(auto task : mTasks)
+    {
+        task->cancel();
+    }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, size_t DIMS>
+typename ParallelForND<TDATA, DIMS>::tile_t ParallelForND<TDATA, DIMS>::wholeTile() const
+{
+    return tile_t(std::array<size_t, DIMS>(), mExtents, mTileSizes);
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, size_t DIMS>
+std::vector<typename ParallelForND<TDATA, DIMS>::tile_t> ParallelForND<TDATA, DIMS>::mortonTiles() const
+{
+    std::array<size_t, DIMS> nbTiles;
+    size_t total = 1;
+    for(size_t dimension = 0; dimension < DIMS; ++dimension)
+    {
+        nbTiles[dimension] = (mExtents[dimension] + mTileSizes[dimension] - 1) / mTileSizes[dimension];
+        total *= nbTiles[dimension];
+    }
+
+    //walk tile coordinates in row major order, keyed by their morton code
+    std::vector<std::pair<uint64_t, std::array<size_t, DIMS>>> coordinates;
+    coordinates.reserve(total);
+    std::array<size_t, DIMS> coordinate = {};
+    for(size_t i = 0; i < total; ++i)
+    {
+        coordinates.emplace_back(detail::mortonCode<DIMS>(coordinate), coordinate);
+        for(size_t dimension = DIMS; dimension-- > 0; )
+        {
+            if(++coordinate[dimension] < nbTiles[dimension]) break;
+            coordinate[dimension] = 0;
+        }
+    }
+    std::sort(coordinates.begin(), coordinates.end());
+
+    std::vector<tile_t> tiles;
+    tiles.reserve(total);
+    for(auto& code : coordinates)
+    {
+        std::array<size_t, DIMS> begins;
+        std::array<size_t, DIMS> ends;
+        for(size_t dimension = 0; dimension < DIMS; ++dimension)
+        {
+            begins[dimension] = code.second[dimension] * mTileSizes[dimension];
+            ends[dimension] = std::min(begins[dimension] + mTileSizes[dimension], mExtents[dimension]);
+        }
+        tiles.emplace_back(begins, ends, mTileSizes);
+    }
+    return tiles;
+}
+
+}
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+#include "async_cpp/async/ParallelGroupBy.h"
+
+namespace async_cpp {
+namespace async {
+
+}
+}
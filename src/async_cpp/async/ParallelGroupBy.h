@@ -0,0 +1,239 @@
+#pragma once
+#include "async_cpp/async/detail/HashPartition.h"
+#include "async_cpp/async/detail/PhasedTask.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace async_cpp {
+namespace async {
+
+/**
+ * Group a set of data by key in parallel, into a vector of data or an aggregate value per key. Blocks of data are 
+ * accumulated into local hash tables, one per key partition, in parallel. Each partition then merges its local tables 
+ * in block order, in parallel, so each group sees data in its original order. Partitions are finally gathered into a 
+ * single map, which is passed to the completion function.
+ */
+//------------------------------------------------------------------------------
+template<class TDATA, class TKEY, class TVALUE = std::vector<TDATA>>
+class ParallelGroupBy {
+public:
+    typedef typename std::function<TKEY(const TDATA&)> key_op_t;
+    typedef typename std::function<void(TVALUE&, TDATA&&)> accumulate_t;
+    typedef typename std::function<void(TVALUE&, TVALUE&&)> combine_t;
+    typedef std::unordered_map<TKEY, TVALUE> result_t;
+    typedef typename detail::PhasedTask<result_t>::then_t then_t;
+
+    /**
+     * Create a parallel group by, collecting data into a vector per key in original order.
+     * @param manager Manager to run tasks against
+     * @param keyOp Operation producing the key of a data item
+     * @param data Data to group
+     * @param grainSize Number of items in each block, chosen from the data size if zero
+     */
+    ParallelGroupBy(tasks::ManagerPtr manager, 
+        typename key_op_t keyOp,
+        std::vector<TDATA>&& data,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a parallel group by, aggregating data into a value per key.
+     * @param manager Manager to run tasks against
+     * @param keyOp Operation producing the key of a data item
+     * @param identity Value each group starts aggregating from
+     * @param accumulateOp Operation adding a data item to a group's value
+     * @param combineOp Operation adding a group's value from later data into a group's value from earlier data
+     * @param data Data to group
+     * @param grainSize Number of items in each block, chosen from the data size if zero
+     */
+    ParallelGroupBy(tasks::ManagerPtr manager, 
+        typename key_op_t keyOp,
+        const TVALUE& identity,
+        typename accumulate_t accumulateOp,
+        typename combine_t combineOp,
+        std::vector<TDATA>&& data,
+        const size_t grainSize = 0);
+
+    /**
+     * Group the set of data, invoking a task with the groups
+     * @param onFinishTask Task to run when all data has been grouped
+     * @return AsyncResult that holds a future completion status, either successful or exception
+     */
+    AsyncResult then(typename then_t onFinishTask);
+
+    /**
+     * Cancel outstanding tasks
+     */
+    void cancel();
+
+private:
+    tasks::ManagerPtr mManager;
+    typename key_op_t mKeyOp;
+    TVALUE mIdentity;
+    typename accumulate_t mAccumulateOp;
+    typename combine_t mCombineOp;
+    std::shared_ptr<std::vector<TDATA>> mData;
+    size_t mGrainSize;
+    std::shared_ptr<tasks::Task> mTask;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TDATA, class TKEY, class TVALUE>
+ParallelGroupBy<TDATA, TKEY, TVALUE>::ParallelGroupBy(tasks::ManagerPtr manager, 
+        typename key_op_t keyOp,
+        std::vector<TDATA>&& data,
+        const size_t grainSize)
+    : mManager(manager),
+      mKeyOp(keyOp),
+      mData(std::make_shared<std::vector<TDATA>>(std::move(data))),
+      mGrainSize(grainSize)
+{
+    static_assert(std::is_same<TVALUE, std::vector<TDATA>>::value, "ParallelGroupBy: Grouping without aggregation requires vector values");
+    if(!mManager) { throw(std::invalid_argument("ParallelGroupBy: Manager cannot be null")); }
+    if(!mKeyOp) { throw(std::invalid_argument("ParallelGroupBy: Key operation cannot be null")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mData->size()); }
+
+    mAccumulateOp = [](TVALUE& group, TDATA&& value)->void
+    {
+        group.push_back(std::move(value));
+    };
+    mCombineOp = [](TVALUE& group, TVALUE&& later)->void
+    {
+        if(group.empty())
+        {
+            group = std::move(later);
+        }
+        else
+        {
+            group.insert(group.end(), std::make_move_iterator(later.begin()), std::make_move_iterator(later.end()));
+        }
+    };
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TKEY, class TVALUE>
+ParallelGroupBy<TDATA, TKEY, TVALUE>::ParallelGroupBy(tasks::ManagerPtr manager, 
+        typename key_op_t keyOp,
+        const TVALUE& identity,
+        typename accumulate_t accumulateOp,
+        typename combine_t combineOp,
+        std::vector<TDATA>&& data,
+        const size_t grainSize)
+    : mManager(manager),
+      mKeyOp(keyOp),
+      mIdentity(identity),
+      mAccumulateOp(accumulateOp),
+      mCombineOp(combineOp),
+      mData(std::make_shared<std::vector<TDATA>>(std::move(data))),
+      mGrainSize(grainSize)
+{
+    if(!mManager) { throw(std::invalid_argument("ParallelGroupBy: Manager cannot be null")); }
+    if(!mKeyOp) { throw(std::invalid_argument("ParallelGroupBy: Key operation cannot be null")); }
+    if(!mAccumulateOp) { throw(std::invalid_argument("ParallelGroupBy: Accumulate operation cannot be null")); }
+    if(!mCombineOp) { throw(std::invalid_argument("ParallelGroupBy: Combine operation cannot be null")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mData->size()); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TKEY, class TVALUE>
+AsyncResult ParallelGroupBy<TDATA, TKEY, TVALUE>::then(typename then_t onFinishOp)
+{
+    auto task = std::make_shared<detail::PhasedTask<result_t>>(mManager, onFinishOp);
+    mTask = task;
+    auto result = task->result();
+
+    auto data = mData;
+    auto keyOp = mKeyOp;
+    auto identity = mIdentity;
+    auto accumulateOp = mAccumulateOp;
+    auto combineOp = mCombineOp;
+    auto grainSize = mGrainSize;
+    auto nbBlocks = (data->size() + grainSize - 1) / grainSize;
+    auto nbPartitions = detail::partitionCount(nbBlocks);
+    //local table for each block and partition, merged into one table per partition
+    auto locals = std::make_shared<std::vector<result_t>>(nbBlocks * nbPartitions);
+    auto partitions = std::make_shared<std::vector<result_t>>(nbPartitions);
+
+    auto accumulateBlocks = [data, keyOp, identity, accumulateOp, locals, nbPartitions, grainSize](const size_t begin, 
+        const size_t end)->void
+    {
+        std::hash<TKEY> hash;
+        for(size_t block = begin; block < end; ++block)
+        {
+            auto last = std::min(data->size(), (block + 1) * grainSize);
+            for(size_t i = block * grainSize; i < last; ++i)
+            {
+                auto key = keyOp((*data)[i]);
+                auto& table = (*locals)[block * nbPartitions + detail::partitionOf(hash(key), nbPartitions)];
+                auto found = table.find(key);
+                if(found == table.end())
+                {
+                    found = table.emplace(std::move(key), identity).first;
+                }
+                accumulateOp(found->second, std::move((*data)[i]));
+            }
+        }
+    };
+
+    auto mergePartitions = [locals, partitions, combineOp, nbBlocks, nbPartitions](const size_t begin, const size_t end)->void
+    {
+        for(size_t partition = begin; partition < end; ++partition)
+        {
+            auto& merged = (*partitions)[partition];
+            for(size_t block = 0; block < nbBlocks; ++block)
+            {
+                auto& local = (*locals)[block * nbPartitions + partition];
+                for(auto& kv : local)
+                {
+                    auto found = merged.find(kv.first);
+                    if(found == merged.end())
+                    {
+                        merged.emplace(kv.first, std::move(kv.second));
+                    }
+                    else
+                    {
+                        combineOp(found->second, std::move(kv.second));
+                    }
+                }
+                result_t().swap(local);
+            }
+        }
+    };
+
+    task->runPhase(nbBlocks, 1, accumulateBlocks, [task, partitions, nbPartitions, mergePartitions]()->void
+    {
+        task->runPhase(nbPartitions, 1, mergePartitions, [task, partitions]()->void
+        {
+            //partitions hold disjoint keys, so gathering them only moves entries
+            size_t total = 0;
+            for(auto& partition : *partitions)
+            {
+                total += partition.size();
+            }
+            result_t groups;
+            groups.reserve(total);
+            for(auto& partition : *partitions)
+            {
+                for(auto& kv : partition)
+                {
+                    groups.emplace(kv.first, std::move(kv.second));
+                }
+                result_t().swap(partition);
+            }
+            task->finish(&groups);
+        } );
+    } );
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TKEY, class TVALUE>
+void ParallelGroupBy<TDATA, TKEY, TVALUE>::cancel()
+{
+    if(mTask) mTask->cancel();
+}
+
+}
+}
\ No newline at end of file
@@ -0,0 +1,169 @@
+#pragma once
+#include "async_cpp/async/detail/ReduceTask.h"
+
+#include <cmath>
+
+namespace async_cpp {
+namespace async {
+
+/**
+ * Count a set of data into a fixed number of bins in parallel, passing the count of each bin to the completion 
+ * function. Each chunk of data counts into its own private bins, so no bin is shared or locked between tasks, and the 
+ * bins of adjacent chunks are summed pairwise in a tree. Items which fall outside of the bins are not counted.
+ */
+//------------------------------------------------------------------------------
+template<class TDATA>
+class ParallelHistogram {
+public:
+    typedef typename std::function<size_t(const TDATA&)> bin_op_t;
+    typedef typename detail::ReduceCollectTask<std::vector<size_t>>::then_t then_t;
+
+    /**
+     * Create a parallel histogram of data by a bin operation.
+     * @param manager Manager to run tasks against
+     * @param binOp Operation producing the bin index of a data item, with indices of nbBins or more not counted
+     * @param nbBins Number of bins to count into
+     * @param data Data to count
+     * @param grainSize Largest number of items counted by a single task, chosen from the data size if zero
+     */
+    ParallelHistogram(tasks::ManagerPtr manager, 
+        typename bin_op_t binOp,
+        const size_t nbBins,
+        std::vector<TDATA>&& data,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a parallel histogram of numeric data into equal width bins covering [lower, upper].
+     * @param manager Manager to run tasks against
+     * @param lower Lowest value counted, the start of the first bin
+     * @param upper Highest value counted, the end of the last bin
+     * @param nbBins Number of bins to count into
+     * @param data Data to count
+     * @param grainSize Largest number of items counted by a single task, chosen from the data size if zero
+     */
+    ParallelHistogram(tasks::ManagerPtr manager, 
+        const TDATA& lower,
+        const TDATA& upper,
+        const size_t nbBins,
+        std::vector<TDATA>&& data,
+        const size_t grainSize = 0);
+
+    /**
+     * Count the set of data, invoking a task with the count of each bin
+     * @param onFinishTask Task to run when all data has been counted
+     * @return AsyncResult that holds a future completion status, either successful or exception
+     */
+    AsyncResult then(typename then_t onFinishTask);
+
+    /**
+     * Cancel outstanding tasks
+     */
+    void cancel();
+
+private:
+    tasks::ManagerPtr mManager;
+    typename bin_op_t mBinOp;
+    size_t mNbBins;
+    std::shared_ptr<std::vector<TDATA>> mData;
+    size_t mGrainSize;
+    std::vector<std::shared_ptr<detail::IParallelTask<std::vector<size_t>>>> mTasks;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TDATA>
+ParallelHistogram<TDATA>::ParallelHistogram(tasks::ManagerPtr manager, 
+        typename bin_op_t binOp,
+        const size_t nbBins,
+        std::vector<TDATA>&& data,
+        const size_t grainSize)
+    : mManager(manager), 
+      mBinOp(binOp),
+      mNbBins(nbBins),
+      mData(std::make_shared<std::vector<TDATA>>(std::move(data))),
+      mGrainSize(grainSize)
+{
+    if(!mManager) { throw(std::invalid_argument("ParallelHistogram: Manager cannot be null")); }
+    if(!mBinOp) { throw(std::invalid_argument("ParallelHistogram: Bin operation cannot be null")); }
+    if(0 == mNbBins) { throw(std::invalid_argument("ParallelHistogram: Number of bins must be greater than 0")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mData->size()); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+ParallelHistogram<TDATA>::ParallelHistogram(tasks::ManagerPtr manager, 
+        const TDATA& lower,
+        const TDATA& upper,
+        const size_t nbBins,
+        std::vector<TDATA>&& data,
+        const size_t grainSize)
+    : ParallelHistogram(manager, 
+        [lower, upper, nbBins](const TDATA& value)->size_t
+        {
+            //written so values which don't compare, such as NaN, are rejected too
+            if(!(lower <= value && value <= upper)) return nbBins;
+            //multiply before dividing, so values on a bin edge aren't rounded into the bin below
+            auto bin = static_cast<size_t>(std::floor(
+                (static_cast<double>(value) - static_cast<double>(lower)) * static_cast<double>(nbBins) / 
+                (static_cast<double>(upper) - static_cast<double>(lower))));
+            //upper is counted in the last bin
+            return bin < nbBins ? bin : nbBins - 1;
+        },
+        nbBins,
+        std::move(data),
+        grainSize)
+{
+    if(!(lower < upper)) { throw(std::invalid_argument("ParallelHistogram: Lower bound must be less than upper bound")); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+AsyncResult ParallelHistogram<TDATA>::then(typename then_t onFinishOp)
+{
+    auto terminalTask(std::make_shared<detail::ReduceCollectTask<std::vector<size_t>>>(mManager, onFinishOp));
+    auto result = terminalTask->result();
+
+    auto data = mData;
+    auto binOp = mBinOp;
+    const auto nbBins = mNbBins;
+    auto op = [data, binOp, nbBins](const size_t begin, const size_t end)->std::vector<size_t>
+    {
+        std::vector<size_t> bins(nbBins, 0);
+        for(size_t i = begin; i < end; ++i)
+        {
+            auto bin = binOp((*data)[i]);
+            if(bin < nbBins) ++bins[bin];
+        }
+        return bins;
+    };
+
+    auto combineOp = [](std::vector<size_t>&& left, std::vector<size_t>&& right)->std::vector<size_t>
+    {
+        for(size_t i = 0; i < left.size(); ++i)
+        {
+            left[i] += right[i];
+        }
+        return std::move(left);
+    };
+
+    auto task = std::make_shared<detail::ReduceTask<std::vector<size_t>>>(mManager, op, combineOp, 
+        detail::BlockedRange(0, mData->size(), mGrainSize), terminalTask);
+    mTasks.emplace_back(terminalTask);
+    mTasks.emplace_back(task);
+    mManager->run(task);
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+void ParallelHistogram<TDATA>::cancel()
+{
+    for(auto task : mTasks)
+    {
+        task->cancel();
+    }
+}
+
+}
+}
\ No newline at end of file
@@ -0,0 +1,160 @@
+#pragma once
+#include "async_cpp/async/detail/ReduceTask.h"
+
+#include <limits>
+#include <utility>
+
+namespace async_cpp {
+namespace async {
+
+/**
+ * Find the least and greatest items of a set of data in parallel in a single pass, passing them as a pair to the 
+ * completion function. Like std::minmax_element, the first least item and the last greatest item are chosen. Chunks 
+ * only track the indices of their least and greatest items, which are combined pairwise. Empty data has no least or 
+ * greatest item, so the completion function receives a null pair.
+ */
+//------------------------------------------------------------------------------
+template<class TDATA>
+class ParallelMinMax {
+public:
+    typedef typename std::function<bool(const TDATA&, const TDATA&)> compare_t;
+    typedef typename std::function<void(std::exception_ptr, std::pair<TDATA, TDATA>*)> then_t;
+
+    /**
+     * Create a parallel search for the least and greatest items of data.
+     * @param manager Manager to run tasks against
+     * @param data Data to search
+     * @param grainSize Largest number of items scanned by a single task, chosen from the data size if zero
+     */
+    ParallelMinMax(tasks::ManagerPtr manager, 
+        std::vector<TDATA>&& data,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a parallel search for the least and greatest items of data by a comparison.
+     * @param manager Manager to run tasks against
+     * @param data Data to search
+     * @param compare Strict weak ordering, true if the first item is less than the second
+     * @param grainSize Largest number of items scanned by a single task, chosen from the data size if zero
+     */
+    ParallelMinMax(tasks::ManagerPtr manager, 
+        std::vector<TDATA>&& data,
+        typename compare_t compare,
+        const size_t grainSize = 0);
+
+    /**
+     * Search the set of data, invoking a task with the least and greatest items
+     * @param onFinishTask Task to run when data has been searched
+     * @return AsyncResult that holds a future completion status, either successful or exception
+     */
+    AsyncResult then(typename then_t onFinishTask);
+
+    /**
+     * Cancel outstanding tasks
+     */
+    void cancel();
+
+private:
+    typedef std::pair<size_t, size_t> indices_t;
+
+    tasks::ManagerPtr mManager;
+    std::shared_ptr<std::vector<TDATA>> mData;
+    typename compare_t mCompare;
+    size_t mGrainSize;
+    std::vector<std::shared_ptr<detail::IParallelTask<indices_t>>> mTasks;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TDATA>
+ParallelMinMax<TDATA>::ParallelMinMax(tasks::ManagerPtr manager, 
+        std::vector<TDATA>&& data,
+        const size_t grainSize)
+    : ParallelMinMax(manager, std::move(data), std::less<TDATA>(), grainSize)
+{
+
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+ParallelMinMax<TDATA>::ParallelMinMax(tasks::ManagerPtr manager, 
+        std::vector<TDATA>&& data,
+        typename compare_t compare,
+        const size_t grainSize)
+    : mManager(manager), 
+      mData(std::make_shared<std::vector<TDATA>>(std::move(data))),
+      mCompare(compare),
+      mGrainSize(grainSize)
+{
+    if(!mManager) { throw(std::invalid_argument("ParallelMinMax: Manager cannot be null")); }
+    if(!mCompare) { throw(std::invalid_argument("ParallelMinMax: Compare operation cannot be null")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mData->size()); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+AsyncResult ParallelMinMax<TDATA>::then(typename then_t onFinishOp)
+{
+    auto data = mData;
+    auto terminalTask(std::make_shared<detail::ReduceCollectTask<indices_t>>(mManager, 
+        [data, onFinishOp](std::exception_ptr ex, indices_t* indices)->void
+    {
+        if(!indices || data->empty())
+        {
+            onFinishOp(ex, nullptr);
+            return;
+        }
+
+        std::pair<TDATA, TDATA> minMax((*data)[indices->first], (*data)[indices->second]);
+        onFinishOp(ex, &minMax);
+    } ));
+    auto result = terminalTask->result();
+
+    auto compare = mCompare;
+    auto op = [data, compare](const size_t begin, const size_t end)->indices_t
+    {
+        if(begin == end) return indices_t(std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max());
+
+        indices_t partial(begin, begin);
+        for(size_t i = begin + 1; i < end; ++i)
+        {
+            const auto& item = (*data)[i];
+            if(compare(item, (*data)[partial.first])) partial.first = i;
+            if(!compare(item, (*data)[partial.second])) partial.second = i;
+        }
+        return partial;
+    };
+
+    //right hand indices are later in the data, so only replace a least item when strictly less
+    auto combineOp = [data, compare](indices_t&& left, indices_t&& right)->indices_t
+    {
+        if(left.first == std::numeric_limits<size_t>::max()) return right;
+        if(right.first == std::numeric_limits<size_t>::max()) return left;
+
+        indices_t combined(left);
+        if(compare((*data)[right.first], (*data)[left.first])) combined.first = right.first;
+        if(!compare((*data)[right.second], (*data)[left.second])) combined.second = right.second;
+        return combined;
+    };
+
+    auto task = std::make_shared<detail::ReduceTask<indices_t>>(mManager, op, combineOp, 
+        detail::BlockedRange(0, mData->size(), mGrainSize), terminalTask);
+    mTasks.emplace_back(terminalTask);
+    mTasks.emplace_back(task);
+    mManager->run(task);
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+void ParallelMinMax<TDATA>::cancel()
+{
+    for(auto task : mTasks)
+    {
+        task->cancel();
+    }
+}
+
+}
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+#pragma once
+#include "async_cpp/async/detail/ReduceTask.h"
+
+namespace async_cpp {
+namespace async {
+
+/**
+ * How a reduction chooses its chunks when no grain size is given.
+ */
+enum class ReduceMode {
+    Fast,           //chunks are chosen from the number of hardware threads
+    Deterministic   //chunks are chosen from the data size alone, so the combine tree and result are reproducible
+};
+
+/**
+ * Reduce a set of data to a single value in parallel. Data is split into chunks, each chunk is accumulated from an 
+ * identity value, and the partial results are combined pairwise in a tree until a single value remains, which is passed 
+ * to the completion function. No intermediate set of per-item results is built. Partials are always combined in the 
+ * same order for the same chunks, regardless of which worker finishes first, so in deterministic mode non-associative 
+ * combinations such as floating point sums give bit identical results on every run and machine.
+ */
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT=TDATA>
+class ParallelReduce {
+public:
+    typedef typename std::function<TRESULT(const TDATA&)> map_t;
+    typedef typename detail::ReduceTask<TRESULT>::combine_t combine_t;
+    typedef typename detail::ReduceCollectTask<TRESULT>::then_t then_t;
+
+    /**
+     * Create a parallel reduction over a set of data.
+     * @param manager Manager to run tasks against
+     * @param identity Value each chunk starts accumulating from, and the result for empty data
+     * @param mapOp Operation transforming a data item into a value to accumulate
+     * @param combineOp Associative operation combining two values, with values from earlier data on the left
+     * @param data Data to reduce
+     * @param grainSize Largest number of items accumulated by a single task, chosen from the data size if zero
+     * @param mode How chunks are chosen when no grain size is given
+     */
+    ParallelReduce(tasks::ManagerPtr manager, 
+        const TRESULT& identity,
+        typename map_t mapOp,
+        typename combine_t combineOp,
+        std::vector<TDATA>&& data,
+        const size_t grainSize = 0,
+        const ReduceMode mode = ReduceMode::Fast);
+
+    /**
+     * Reduce the set of data, invoking a task with the reduced value
+     * @param onFinishTask Task to run when all data has been reduced
+     * @return AsyncResult that holds a future completion status, either successful or exception
+     */
+    AsyncResult then(typename then_t onFinishTask);
+
+    /**
+     * Cancel outstanding tasks
+     */
+    void cancel();
+
+private:
+    tasks::ManagerPtr mManager;
+    TRESULT mIdentity;
+    typename map_t mMapOp;
+    typename combine_t mCombineOp;
+    std::shared_ptr<std::vector<TDATA>> mData;
+    size_t mGrainSize;
+    std::vector<std::shared_ptr<detail::IParallelTask<TRESULT>>> mTasks;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+ParallelReduce<TDATA, TRESULT>::ParallelReduce(tasks::ManagerPtr manager, 
+        const TRESULT& identity,
+        typename map_t mapOp,
+        typename combine_t combineOp,
+        std::vector<TDATA>&& data,
+        const size_t grainSize,
+        const ReduceMode mode)
+    : mManager(manager), 
+      mIdentity(identity), 
+      mMapOp(mapOp), 
+      mCombineOp(combineOp),
+      mData(std::make_shared<std::vector<TDATA>>(std::move(data))),
+      mGrainSize(grainSize)
+{
+    if(!mManager) { throw(std::invalid_argument("ParallelReduce: Manager cannot be null")); }
+    if(!mMapOp) { throw(std::invalid_argument("ParallelReduce: Map operation cannot be null")); }
+    if(!mCombineOp) { throw(std::invalid_argument("ParallelReduce: Combine operation cannot be null")); }
+    if(0 == mGrainSize)
+    {
+        mGrainSize = (ReduceMode::Deterministic == mode) ? detail::BlockedRange::deterministicGrainSize(mData->size()) 
+            : detail::BlockedRange::defaultGrainSize(mData->size());
+    }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+AsyncResult ParallelReduce<TDATA, TRESULT>::then(typename then_t onFinishOp)
+{
+    auto terminalTask(std::make_shared<detail::ReduceCollectTask<TRESULT>>(mManager, onFinishOp));
+    auto result = terminalTask->result();
+
+    auto data = mData;
+    auto identity = mIdentity;
+    auto mapOp = mMapOp;
+    auto combineOp = mCombineOp;
+    auto op = [data, identity, mapOp, combineOp](const size_t begin, const size_t end)->TRESULT
+    {
+        auto partial = identity;
+        for(size_t i = begin; i < end; ++i)
+        {
+            partial = combineOp(std::move(partial), mapOp((*data)[i]));
+        }
+        return partial;
+    };
+
+    auto task = std::make_shared<detail::ReduceTask<TRESULT>>(mManager, op, mCombineOp, 
+        detail::BlockedRange(0, mData->size(), mGrainSize), terminalTask);
+    mTasks.emplace_back(terminalTask);
+    mTasks.emplace_back(task);
+    mManager->run(task);
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+void ParallelReduce<TDATA, TRESULT>::cancel()
+{
+    for(auto task : mTasks)
+    {
+        task->cancel();
+    }
+}
+
+}
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+#pragma once
+#include "async_cpp/async/detail/PhasedTask.h"
+
+namespace async_cpp {
+namespace async {
+
+/**
+ * Whether each output of a scan includes its own input.
+ */
+enum class ScanMode {
+    Inclusive,  //output i combines inputs [0, i]
+    Exclusive   //output i combines inputs [0, i), starting from the identity
+};
+
+/**
+ * Compute prefix combinations of a set of data in parallel, such as running sums for offset calculations. Data is 
+ * split into blocks, each block is reduced in parallel, block totals are scanned into offsets, and then each block is 
+ * scanned from its offset in parallel. The data is scanned in place and passed to the completion function.
+ */
+//------------------------------------------------------------------------------
+template<class TDATA>
+class ParallelScan {
+public:
+    typedef typename std::function<TDATA(const TDATA&, const TDATA&)> operation_t;
+    typedef typename detail::PhasedTask<std::vector<TDATA>>::then_t then_t;
+
+    /**
+     * Create a parallel scan over a set of data.
+     * @param manager Manager to run tasks against
+     * @param op Associative operation combining two values, with values from earlier data on the left
+     * @param identity Value which leaves any other value unchanged when combined with it
+     * @param data Data to scan in place
+     * @param mode Whether each output includes its own input
+     * @param grainSize Number of items in each block, chosen from the data size if zero
+     */
+    ParallelScan(tasks::ManagerPtr manager, 
+        typename operation_t op,
+        const TDATA& identity,
+        std::vector<TDATA>&& data,
+        const ScanMode mode = ScanMode::Inclusive,
+        const size_t grainSize = 0);
+
+    /**
+     * Scan the set of data, invoking a task with the scanned data
+     * @param onFinishTask Task to run when all data has been scanned
+     * @return AsyncResult that holds a future completion status, either successful or exception
+     */
+    AsyncResult then(typename then_t onFinishTask);
+
+    /**
+     * Cancel outstanding tasks
+     */
+    void cancel();
+
+private:
+    tasks::ManagerPtr mManager;
+    typename operation_t mOp;
+    TDATA mIdentity;
+    std::shared_ptr<std::vector<TDATA>> mData;
+    ScanMode mMode;
+    size_t mGrainSize;
+    std::shared_ptr<tasks::Task> mTask;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TDATA>
+ParallelScan<TDATA>::ParallelScan(tasks::ManagerPtr manager, 
+        typename operation_t op,
+        const TDATA& identity,
+        std::vector<TDATA>&& data,
+        const ScanMode mode,
+        const size_t grainSize)
+    : mManager(manager), 
+      mOp(op), 
+      mIdentity(identity), 
+      mData(std::make_shared<std::vector<TDATA>>(std::move(data))),
+      mMode(mode),
+      mGrainSize(grainSize)
+{
+    if(!mManager) { throw(std::invalid_argument("ParallelScan: Manager cannot be null")); }
+    if(!mOp) { throw(std::invalid_argument("ParallelScan: Operation cannot be null")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mData->size()); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+AsyncResult ParallelScan<TDATA>::then(typename then_t onFinishOp)
+{
+    auto task = std::make_shared<detail::PhasedTask<std::vector<TDATA>>>(mManager, onFinishOp);
+    mTask = task;
+    auto result = task->result();
+
+    auto data = mData;
+    auto op = mOp;
+    auto identity = mIdentity;
+    auto inclusive = (ScanMode::Inclusive == mMode);
+    auto grainSize = mGrainSize;
+    auto nbBlocks = (data->size() + grainSize - 1) / grainSize;
+    auto blockSums = std::make_shared<std::vector<TDATA>>(nbBlocks, identity);
+
+    //upsweep: total each block
+    auto reduceBlocks = [data, op, identity, blockSums, grainSize](const size_t begin, const size_t end)->void
+    {
+        for(size_t block = begin; block < end; ++block)
+        {
+            auto sum = identity;
+            auto last = std::min(data->size(), (block + 1) * grainSize);
+            for(size_t i = block * grainSize; i < last; ++i)
+            {
+                sum = op(sum, (*data)[i]);
+            }
+            (*blockSums)[block] = std::move(sum);
+        }
+    };
+
+    //downsweep: scan each block starting from the combined total of all blocks before it
+    auto scanBlocks = [data, op, blockSums, grainSize, inclusive](const size_t begin, const size_t end)->void
+    {
+        for(size_t block = begin; block < end; ++block)
+        {
+            auto sum = (*blockSums)[block];
+            auto last = std::min(data->size(), (block + 1) * grainSize);
+            for(size_t i = block * grainSize; i < last; ++i)
+            {
+                auto& value = (*data)[i];
+                if(inclusive)
+                {
+                    sum = op(sum, value);
+                    value = sum;
+                }
+                else
+                {
+                    auto next = op(sum, value);
+                    value = std::move(sum);
+                    sum = std::move(next);
+                }
+            }
+        }
+    };
+
+    std::weak_ptr<detail::PhasedTask<std::vector<TDATA>>> weakTask = task;
+    task->runPhase(nbBlocks, 1, reduceBlocks, [weakTask, data, op, identity, blockSums, nbBlocks, scanBlocks]()->void
+    {
+        auto task = weakTask.lock();
+        if(!task) return;
+
+        //few blocks, so offsets are scanned serially
+        auto offset = identity;
+        for(auto& sum : *blockSums)
+        {
+            auto next = op(offset, sum);
+            sum = std::move(offset);
+            offset = std::move(next);
+        }
+
+        task->runPhase(nbBlocks, 1, scanBlocks, [weakTask, data]()->void
+        {
+            auto task = weakTask.lock();
+            if(task) task->finish(data.get());
+        } );
+    } );
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+void ParallelScan<TDATA>::cancel()
+{
+    if(mTask) mTask->cancel();
+}
+
+}
+}
\ No newline at end of file
@@ -0,0 +1,490 @@
+#pragma once
+#include "async_cpp/async/detail/Compaction.h"
+#include "async_cpp/async/detail/HashPartition.h"
+#include "async_cpp/async/detail/MergePath.h"
+#include "async_cpp/async/detail/PhasedTask.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace async_cpp {
+namespace async {
+
+/**
+ * Operation combining two sets of data.
+ */
+enum class SetOperation {
+    Intersect,  //items found in both sets
+    Union,      //items found in either set
+    Difference  //items of the first set not found in the second
+};
+
+/**
+ * Combine two sets of data in parallel, passing the combined set to the completion function. Sorted sets are combined
+ * as by std::set_intersection, std::set_union and std::set_difference, keeping equivalent items as many times as those
+ * functions do. Both sets are split along their merge path into chunks of balanced size, moved back to the start of any
+ * run of equivalent items so matching items stay in one chunk. Each chunk counts its output in parallel, counts are
+ * scanned into output offsets, and each chunk writes its output into a preallocated set in parallel. Data must be
+ * default constructible.
+ *
+ * Unsorted sets are instead combined by hashing, with items of both sets split into partitions by hash and each
+ * partition checked with its own hash sets in parallel. Duplicates are removed, and items keep their original order,
+ * with the first set's items preceding the second's in a union.
+ */
+//------------------------------------------------------------------------------
+template<class TDATA, SetOperation OPERATION>
+class ParallelSetOperation {
+public:
+    typedef typename std::function<bool(const TDATA&, const TDATA&)> compare_t;
+    typedef typename std::function<size_t(const TDATA&)> hash_op_t;
+    typedef typename std::function<bool(const TDATA&, const TDATA&)> equal_op_t;
+    typedef typename detail::PhasedTask<std::vector<TDATA>>::then_t then_t;
+
+    /**
+     * Create a parallel operation on two sets sorted in ascending order.
+     * @param manager Manager to run tasks against
+     * @param first First sorted set of data
+     * @param second Second sorted set of data
+     * @param grainSize Number of items of both sets in each chunk, chosen from the data size if zero
+     */
+    ParallelSetOperation(tasks::ManagerPtr manager,
+        std::vector<TDATA>&& first,
+        std::vector<TDATA>&& second,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a parallel operation on two sets sorted by a comparison.
+     * @param manager Manager to run tasks against
+     * @param first First sorted set of data
+     * @param second Second sorted set of data
+     * @param compare Strict weak ordering both sets are sorted by
+     * @param grainSize Number of items of both sets in each chunk, chosen from the data size if zero
+     */
+    ParallelSetOperation(tasks::ManagerPtr manager,
+        std::vector<TDATA>&& first,
+        std::vector<TDATA>&& second,
+        typename compare_t compare,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a parallel operation on two unsorted sets, which hashes data.
+     * @param manager Manager to run tasks against
+     * @param hashOp Operation to hash data, equal data must have equal hashes
+     * @param equalOp Operation to use to determine if two data points are equal
+     * @param first First set of data
+     * @param second Second set of data
+     * @param grainSize Number of items in each block, chosen from the data size if zero
+     */
+    ParallelSetOperation(tasks::ManagerPtr manager,
+        typename hash_op_t hashOp,
+        typename equal_op_t equalOp,
+        std::vector<TDATA>&& first,
+        std::vector<TDATA>&& second,
+        const size_t grainSize = 0);
+
+    /**
+     * Combine the sets of data, invoking a task with the combined set
+     * @param onFinishTask Task to run when sets have been combined
+     * @return AsyncResult that holds a future completion status, either successful or exception
+     */
+    AsyncResult then(typename then_t onFinishTask);
+
+    /**
+     * Cancel outstanding tasks
+     */
+    void cancel();
+
+private:
+    typedef std::shared_ptr<std::vector<TDATA>> data_ptr_t;
+    typedef std::shared_ptr<detail::PhasedTask<std::vector<TDATA>>> task_ptr_t;
+    typedef std::pair<size_t, size_t> split_t;
+
+    static void combineSorted(task_ptr_t task,
+        data_ptr_t first,
+        data_ptr_t second,
+        typename compare_t compare,
+        const size_t grainSize);
+    static void combineHashed(task_ptr_t task,
+        data_ptr_t first,
+        data_ptr_t second,
+        typename hash_op_t hashOp,
+        typename equal_op_t equalOp,
+        const size_t grainSize);
+    static split_t splitAt(const size_t diagonal,
+        const std::vector<TDATA>& first,
+        const std::vector<TDATA>& second,
+        const typename compare_t& compare);
+    template<class TEMIT>
+    static void combineChunk(std::vector<TDATA>& first,
+        std::vector<TDATA>& second,
+        const split_t& begin,
+        const split_t& end,
+        const typename compare_t& compare,
+        TEMIT& emit);
+
+    tasks::ManagerPtr mManager;
+    data_ptr_t mFirst;
+    data_ptr_t mSecond;
+    typename compare_t mCompare;
+    typename hash_op_t mHashOp;
+    typename equal_op_t mEqualOp;
+    size_t mGrainSize;
+    std::shared_ptr<tasks::Task> mTask;
+};
+
+/**
+ * Find the items found in both of two sets of data in parallel.
+ */
+template<class TDATA>
+using ParallelIntersect = ParallelSetOperation<TDATA, SetOperation::Intersect>;
+
+/**
+ * Find the items found in either of two sets of data in parallel.
+ */
+template<class TDATA>
+using ParallelUnion = ParallelSetOperation<TDATA, SetOperation::Union>;
+
+/**
+ * Find the items of one set of data not found in another in parallel.
+ */
+template<class TDATA>
+using ParallelDifference = ParallelSetOperation<TDATA, SetOperation::Difference>;
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TDATA, SetOperation OPERATION>
+ParallelSetOperation<TDATA, OPERATION>::ParallelSetOperation(tasks::ManagerPtr manager,
+        std::vector<TDATA>&& first,
+        std::vector<TDATA>&& second,
+        const size_t grainSize)
+    : ParallelSetOperation(manager, std::move(first), std::move(second),
+        [](const TDATA& left, const TDATA& right)->bool { return left < right; }, grainSize)
+{
+
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, SetOperation OPERATION>
+ParallelSetOperation<TDATA, OPERATION>::ParallelSetOperation(tasks::ManagerPtr manager,
+        std::vector<TDATA>&& first,
+        std::vector<TDATA>&& second,
+        typename compare_t compare,
+        const size_t grainSize)
+    : mManager(manager),
+      mFirst(std::make_shared<std::vector<TDATA>>(std::move(first))),
+      mSecond(std::make_shared<std::vector<TDATA>>(std::move(second))),
+      mCompare(compare),
+      mGrainSize(grainSize)
+{
+    if(!mManager) { throw(std::invalid_argument("ParallelSetOperation: Manager cannot be null")); }
+    if(!mCompare) { throw(std::invalid_argument("ParallelSetOperation: Comparison cannot be null")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mFirst->size() + mSecond->size()); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, SetOperation OPERATION>
+ParallelSetOperation<TDATA, OPERATION>::ParallelSetOperation(tasks::ManagerPtr manager,
+        typename hash_op_t hashOp,
+        typename equal_op_t equalOp,
+        std::vector<TDATA>&& first,
+        std::vector<TDATA>&& second,
+        const size_t grainSize)
+    : mManager(manager),
+      mFirst(std::make_shared<std::vector<TDATA>>(std::move(first))),
+      mSecond(std::make_shared<std::vector<TDATA>>(std::move(second))),
+      mHashOp(hashOp),
+      mEqualOp(equalOp),
+      mGrainSize(grainSize)
+{
+    if(!mManager) { throw(std::invalid_argument("ParallelSetOperation: Manager cannot be null")); }
+    if(!mHashOp) { throw(std::invalid_argument("ParallelSetOperation: Hash operation cannot be null")); }
+    if(!mEqualOp) { throw(std::invalid_argument("ParallelSetOperation: Equal operation cannot be null")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mFirst->size() + mSecond->size()); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, SetOperation OPERATION>
+AsyncResult ParallelSetOperation<TDATA, OPERATION>::then(typename then_t onFinishOp)
+{
+    auto task = std::make_shared<detail::PhasedTask<std::vector<TDATA>>>(mManager, onFinishOp);
+    mTask = task;
+    auto result = task->result();
+
+    if(mHashOp)
+    {
+        combineHashed(task, mFirst, mSecond, mHashOp, mEqualOp, mGrainSize);
+    }
+    else
+    {
+        combineSorted(task, mFirst, mSecond, mCompare, mGrainSize);
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, SetOperation OPERATION>
+void ParallelSetOperation<TDATA, OPERATION>::cancel()
+{
+    if(mTask) mTask->cancel();
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, SetOperation OPERATION>
+void ParallelSetOperation<TDATA, OPERATION>::combineSorted(task_ptr_t task,
+    data_ptr_t first,
+    data_ptr_t second,
+    typename compare_t compare,
+    const size_t grainSize)
+{
+    auto total = first->size() + second->size();
+    auto nbChunks = (total + grainSize - 1) / grainSize;
+    //where each chunk starts in both sets, with the end of both sets last
+    auto splits = std::make_shared<std::vector<split_t>>(nbChunks + 1, split_t(first->size(), second->size()));
+    auto counts = std::make_shared<std::vector<size_t>>(nbChunks, 0);
+
+    auto countChunks = [first, second, compare, splits, counts, total, grainSize](const size_t begin, const size_t end)->void
+    {
+        for(size_t chunk = begin; chunk < end; ++chunk)
+        {
+            auto chunkBegin = splitAt(chunk * grainSize, *first, *second, compare);
+            auto chunkEnd = splitAt(std::min(total, (chunk + 1) * grainSize), *first, *second, compare);
+            (*splits)[chunk] = chunkBegin;
+
+            size_t count = 0;
+            auto countItem = [&count](TDATA&)->void
+            {
+                ++count;
+            };
+            combineChunk(*first, *second, chunkBegin, chunkEnd, compare, countItem);
+            (*counts)[chunk] = count;
+        }
+    };
+
+    task->runPhase(nbChunks, 1, countChunks, [task, first, second, compare, splits, counts]()->void
+    {
+        size_t outputSize = 0;
+        for(auto& count : *counts)
+        {
+            auto offset = outputSize;
+            outputSize += count;
+            count = offset;
+        }
+
+        auto output = std::make_shared<std::vector<TDATA>>(outputSize);
+        auto writeChunks = [first, second, compare, splits, counts, output](const size_t begin, const size_t end)->void
+        {
+            for(size_t chunk = begin; chunk < end; ++chunk)
+            {
+                //each item is output at most once, so can be moved
+                auto position = output->begin() + (*counts)[chunk];
+                auto writeItem = [&position](TDATA& item)->void
+                {
+                    *position++ = std::move(item);
+                };
+                combineChunk(*first, *second, (*splits)[chunk], (*splits)[chunk + 1], compare, writeItem);
+            }
+        };
+
+        task->runPhase(counts->size(), 1, writeChunks, [task, output]()->void
+        {
+            task->finish(output.get());
+        } );
+    } );
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, SetOperation OPERATION>
+typename ParallelSetOperation<TDATA, OPERATION>::split_t ParallelSetOperation<TDATA, OPERATION>::splitAt(
+    const size_t diagonal,
+    const std::vector<TDATA>& first,
+    const std::vector<TDATA>& second,
+    const typename compare_t& compare)
+{
+    auto firstCount = detail::mergePathSplit(diagonal, first.begin(), first.size(), second.begin(), second.size(), compare);
+    auto secondCount = diagonal - firstCount;
+
+    //the next item of the merge, with equivalent items taken from the first set first
+    const TDATA* next = nullptr;
+    if(firstCount < first.size() && (secondCount == second.size() || !compare(second[secondCount], first[firstCount])))
+    {
+        next = &first[firstCount];
+    }
+    else if(secondCount < second.size())
+    {
+        next = &second[secondCount];
+    }
+    if(!next) return split_t(first.size(), second.size());
+
+    //move back to the start of the run of items equivalent to it, so matching items are never split between chunks
+    return split_t(
+        static_cast<size_t>(std::lower_bound(first.begin(), first.end(), *next, compare) - first.begin()),
+        static_cast<size_t>(std::lower_bound(second.begin(), second.end(), *next, compare) - second.begin()));
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, SetOperation OPERATION>
+template<class TEMIT>
+void ParallelSetOperation<TDATA, OPERATION>::combineChunk(std::vector<TDATA>& first,
+    std::vector<TDATA>& second,
+    const split_t& begin,
+    const split_t& end,
+    const typename compare_t& compare,
+    TEMIT& emit)
+{
+    auto i = begin.first;
+    auto j = begin.second;
+    while(i < end.first && j < end.second)
+    {
+        if(compare(first[i], second[j]))
+        {
+            if(SetOperation::Intersect != OPERATION) emit(first[i]);
+            ++i;
+        }
+        else if(compare(second[j], first[i]))
+        {
+            if(SetOperation::Union == OPERATION) emit(second[j]);
+            ++j;
+        }
+        else
+        {
+            if(SetOperation::Difference != OPERATION) emit(first[i]);
+            ++i;
+            ++j;
+        }
+    }
+
+    if(SetOperation::Intersect != OPERATION)
+    {
+        for(; i < end.first; ++i)
+        {
+            emit(first[i]);
+        }
+    }
+    if(SetOperation::Union == OPERATION)
+    {
+        for(; j < end.second; ++j)
+        {
+            emit(second[j]);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, SetOperation OPERATION>
+void ParallelSetOperation<TDATA, OPERATION>::combineHashed(task_ptr_t task,
+    data_ptr_t first,
+    data_ptr_t second,
+    typename hash_op_t hashOp,
+    typename equal_op_t equalOp,
+    const size_t grainSize)
+{
+    //blocks of the first set are followed by blocks of the second
+    auto nbFirstBlocks = (first->size() + grainSize - 1) / grainSize;
+    auto nbBlocks = nbFirstBlocks + (second->size() + grainSize - 1) / grainSize;
+    auto nbPartitions = detail::partitionCount(nbBlocks);
+    //items of each block and partition, in order, so each partition sees items in their original order
+    auto partitions = std::make_shared<std::vector<std::vector<const TDATA*>>>(nbBlocks * nbPartitions);
+    auto keepFirst = std::make_shared<std::vector<uint8_t>>(first->size(), 0);
+    auto keepSecond = std::make_shared<std::vector<uint8_t>>(second->size(), 0);
+
+    auto hashBlocks = [first, second, hashOp, partitions, nbFirstBlocks, nbPartitions, grainSize](const size_t begin,
+        const size_t end)->void
+    {
+        for(size_t block = begin; block < end; ++block)
+        {
+            auto& data = (block < nbFirstBlocks) ? *first : *second;
+            auto offset = ((block < nbFirstBlocks) ? block : block - nbFirstBlocks) * grainSize;
+            auto last = std::min(data.size(), offset + grainSize);
+            for(size_t i = offset; i < last; ++i)
+            {
+                (*partitions)[block * nbPartitions + detail::partitionOf(hashOp(data[i]), nbPartitions)].push_back(&data[i]);
+            }
+        }
+    };
+
+    auto checkPartitions = [first, second, hashOp, equalOp, partitions, keepFirst, keepSecond, nbFirstBlocks, nbBlocks,
+        nbPartitions](const size_t begin, const size_t end)->void
+    {
+        typedef std::unordered_set<const TDATA*,
+            std::function<size_t(const TDATA*)>,
+            std::function<bool(const TDATA*, const TDATA*)>> item_set_t;
+        std::function<size_t(const TDATA*)> itemHash = [hashOp](const TDATA* item)->size_t
+        {
+            return hashOp(*item);
+        };
+        std::function<bool(const TDATA*, const TDATA*)> itemEqual = [equalOp](const TDATA* left, const TDATA* right)->bool
+        {
+            return equalOp(*left, *right);
+        };
+        for(size_t partition = begin; partition < end; ++partition)
+        {
+            item_set_t seenSecond(0, itemHash, itemEqual);
+            for(size_t block = nbFirstBlocks; block < nbBlocks; ++block)
+            {
+                for(auto item : (*partitions)[block * nbPartitions + partition])
+                {
+                    if(seenSecond.insert(item).second && SetOperation::Union == OPERATION)
+                    {
+                        //first occurrence in the second set, dropped below if also in the first
+                        (*keepSecond)[item - second->data()] = 1;
+                    }
+                }
+            }
+
+            item_set_t seenFirst(0, itemHash, itemEqual);
+            for(size_t block = 0; block < nbFirstBlocks; ++block)
+            {
+                for(auto item : (*partitions)[block * nbPartitions + partition])
+                {
+                    if(!seenFirst.insert(item).second) continue;
+
+                    auto inSecond = seenSecond.end() != seenSecond.find(item);
+                    if(SetOperation::Union == OPERATION)
+                    {
+                        (*keepFirst)[item - first->data()] = 1;
+                        if(inSecond) (*keepSecond)[*seenSecond.find(item) - second->data()] = 0;
+                    }
+                    else
+                    {
+                        (*keepFirst)[item - first->data()] = ((SetOperation::Intersect == OPERATION) == inSecond) ? 1 : 0;
+                    }
+                }
+            }
+        }
+    };
+
+    task->runPhase(nbBlocks, 1, hashBlocks, [task, first, second, partitions, keepFirst, keepSecond, grainSize, nbPartitions,
+        checkPartitions]()->void
+    {
+        task->runPhase(nbPartitions, 1, checkPartitions, [task, first, second, partitions, keepFirst, keepSecond,
+            grainSize]()->void
+        {
+            std::vector<std::vector<const TDATA*>>().swap(*partitions);
+            detail::compact<TDATA>(task, first, keepFirst, grainSize, [task, second, keepSecond, grainSize](
+                std::shared_ptr<std::vector<TDATA>> firstKept)->void
+            {
+                if(SetOperation::Union != OPERATION)
+                {
+                    task->finish(firstKept.get());
+                    return;
+                }
+
+                detail::compact<TDATA>(task, second, keepSecond, grainSize, [task, firstKept](
+                    std::shared_ptr<std::vector<TDATA>> secondKept)->void
+                {
+                    firstKept->reserve(firstKept->size() + secondKept->size());
+                    std::move(secondKept->begin(), secondKept->end(), std::back_inserter(*firstKept));
+                    task->finish(firstKept.get());
+                } );
+            } );
+        } );
+    } );
+}
+
+}
+}
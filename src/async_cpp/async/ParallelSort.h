@@ -0,0 +1,336 @@
+#pragma once
+#include "async_cpp/async/detail/MergePath.h"
+#include "async_cpp/async/detail/PhasedTask.h"
+#include "async_cpp/async/detail/RadixKey.h"
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+namespace async_cpp {
+namespace async {
+
+/**
+ * Stably sort a set of data in parallel, passing the sorted data to the completion function. With a comparison, data is 
+ * merge sorted: blocks are sorted in parallel, then adjacent runs are merged in rounds, with each merge split into 
+ * chunks along its merge path so all workers take part in every round. Sorting arithmetic data ascending without a 
+ * comparison uses a least significant digit radix sort instead, with per-block digit counts and parallel scatters.
+ * Data must be default constructible, as a buffer of the same size is used.
+ */
+//------------------------------------------------------------------------------
+template<class TDATA>
+class ParallelSort {
+public:
+    typedef typename std::function<bool(const TDATA&, const TDATA&)> compare_t;
+    typedef typename detail::PhasedTask<std::vector<TDATA>>::then_t then_t;
+
+    /**
+     * Create a parallel sort of data in ascending order.
+     * @param manager Manager to run tasks against
+     * @param data Data to sort
+     * @param grainSize Number of items in each block, chosen from the data size if zero
+     */
+    ParallelSort(tasks::ManagerPtr manager, 
+        std::vector<TDATA>&& data,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a parallel sort of data by a comparison.
+     * @param manager Manager to run tasks against
+     * @param data Data to sort
+     * @param compare Strict weak ordering to sort by
+     * @param grainSize Number of items in each block, chosen from the data size if zero
+     */
+    ParallelSort(tasks::ManagerPtr manager, 
+        std::vector<TDATA>&& data,
+        typename compare_t compare,
+        const size_t grainSize = 0);
+
+    /**
+     * Sort the set of data, invoking a task with the sorted data
+     * @param onFinishTask Task to run when data has been sorted
+     * @return AsyncResult that holds a future completion status, either successful or exception
+     */
+    AsyncResult then(typename then_t onFinishTask);
+
+    /**
+     * Cancel outstanding tasks
+     */
+    void cancel();
+
+private:
+    typedef std::shared_ptr<std::vector<TDATA>> data_ptr_t;
+    typedef std::shared_ptr<detail::PhasedTask<std::vector<TDATA>>> task_ptr_t;
+    typedef std::integral_constant<bool, std::is_arithmetic<TDATA>::value && sizeof(TDATA) <= sizeof(uint64_t)> is_radix_t;
+
+    void sortAscending(task_ptr_t task, std::true_type isRadix);
+    void sortAscending(task_ptr_t task, std::false_type isRadix);
+
+    static void mergeSort(task_ptr_t task, data_ptr_t data, typename compare_t compare, const size_t grainSize);
+    static void mergeRound(task_ptr_t task, 
+        data_ptr_t source, 
+        data_ptr_t destination, 
+        typename compare_t compare, 
+        const size_t width, 
+        const size_t grainSize);
+    static void radixPass(task_ptr_t task, 
+        data_ptr_t source, 
+        data_ptr_t destination, 
+        const size_t digit, 
+        const size_t grainSize);
+
+    tasks::ManagerPtr mManager;
+    data_ptr_t mData;
+    typename compare_t mCompare;
+    size_t mGrainSize;
+    std::shared_ptr<tasks::Task> mTask;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TDATA>
+ParallelSort<TDATA>::ParallelSort(tasks::ManagerPtr manager, 
+        std::vector<TDATA>&& data,
+        const size_t grainSize)
+    : mManager(manager), 
+      mData(std::make_shared<std::vector<TDATA>>(std::move(data))),
+      mGrainSize(grainSize)
+{
+    if(!mManager) { throw(std::invalid_argument("ParallelSort: Manager cannot be null")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mData->size()); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+ParallelSort<TDATA>::ParallelSort(tasks::ManagerPtr manager, 
+        std::vector<TDATA>&& data,
+        typename compare_t compare,
+        const size_t grainSize)
+    : mManager(manager), 
+      mData(std::make_shared<std::vector<TDATA>>(std::move(data))),
+      mCompare(compare),
+      mGrainSize(grainSize)
+{
+    if(!mManager) { throw(std::invalid_argument("ParallelSort: Manager cannot be null")); }
+    if(!mCompare) { throw(std::invalid_argument("ParallelSort: Comparison cannot be null")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mData->size()); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+AsyncResult ParallelSort<TDATA>::then(typename then_t onFinishOp)
+{
+    auto task = std::make_shared<detail::PhasedTask<std::vector<TDATA>>>(mManager, onFinishOp);
+    mTask = task;
+    auto result = task->result();
+
+    if(mCompare)
+    {
+        mergeSort(task, mData, mCompare, mGrainSize);
+    }
+    else
+    {
+        sortAscending(task, is_radix_t());
+    }
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+void ParallelSort<TDATA>::cancel()
+{
+    if(mTask) mTask->cancel();
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+void ParallelSort<TDATA>::sortAscending(task_ptr_t task, std::true_type)
+{
+    auto buffer = std::make_shared<std::vector<TDATA>>(mData->size());
+    radixPass(task, mData, buffer, 0, mGrainSize);
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+void ParallelSort<TDATA>::sortAscending(task_ptr_t task, std::false_type)
+{
+    mergeSort(task, mData, std::less<TDATA>(), mGrainSize);
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+void ParallelSort<TDATA>::mergeSort(task_ptr_t task, data_ptr_t data, typename compare_t compare, const size_t grainSize)
+{
+    auto nbBlocks = (data->size() + grainSize - 1) / grainSize;
+    auto sortBlocks = [data, compare, grainSize](const size_t begin, const size_t end)->void
+    {
+        for(size_t block = begin; block < end; ++block)
+        {
+            auto first = data->begin() + block * grainSize;
+            auto last = data->begin() + std::min(data->size(), (block + 1) * grainSize);
+            std::stable_sort(first, last, compare);
+        }
+    };
+
+    task->runPhase(nbBlocks, 1, sortBlocks, [task, data, compare, grainSize]()->void
+    {
+        auto buffer = std::make_shared<std::vector<TDATA>>(data->size());
+        mergeRound(task, data, buffer, compare, grainSize, grainSize);
+    } );
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+void ParallelSort<TDATA>::mergeRound(task_ptr_t task, 
+    data_ptr_t source, 
+    data_ptr_t destination, 
+    typename compare_t compare, 
+    const size_t width, 
+    const size_t grainSize)
+{
+    if(width >= source->size())
+    {
+        task->finish(source.get());
+        return;
+    }
+
+    //output chunks never straddle a pair of runs, as run widths are multiples of the grain size
+    auto nbChunks = (source->size() + grainSize - 1) / grainSize;
+    //number of items each chunk takes from the first run of its pair, found before any items are moved
+    auto splits = std::make_shared<std::vector<size_t>>(nbChunks + 1, 0);
+    auto findSplits = [source, splits, compare, width, grainSize](const size_t begin, const size_t end)->void
+    {
+        auto size = source->size();
+        for(size_t chunk = begin; chunk < end; ++chunk)
+        {
+            auto outBegin = chunk * grainSize;
+            auto pairBegin = outBegin - outBegin % (2 * width);
+            auto middle = std::min(size, pairBegin + width);
+            auto pairEnd = std::min(size, pairBegin + 2 * width);
+            (*splits)[chunk] = detail::mergePathSplit(outBegin - pairBegin, 
+                source->begin() + pairBegin, middle - pairBegin, 
+                source->begin() + middle, pairEnd - middle, 
+                compare);
+        }
+    };
+
+    auto mergeChunks = [source, destination, splits, compare, width, grainSize](const size_t begin, const size_t end)->void
+    {
+        auto size = source->size();
+        for(size_t chunk = begin; chunk < end; ++chunk)
+        {
+            auto outBegin = chunk * grainSize;
+            auto outEnd = std::min(size, outBegin + grainSize);
+            auto pairBegin = outBegin - outBegin % (2 * width);
+            auto middle = std::min(size, pairBegin + width);
+            auto pairEnd = std::min(size, pairBegin + 2 * width);
+
+            auto lowSplit = (*splits)[chunk];
+            //the last chunk of a pair ends with the whole of its first run
+            auto highSplit = (outEnd == pairEnd) ? middle - pairBegin : (*splits)[chunk + 1];
+            auto first = source->begin() + pairBegin;
+            auto second = source->begin() + middle;
+            std::merge(std::make_move_iterator(first + lowSplit), 
+                std::make_move_iterator(first + highSplit),
+                std::make_move_iterator(second + (outBegin - pairBegin - lowSplit)), 
+                std::make_move_iterator(second + (outEnd - pairBegin - highSplit)),
+                destination->begin() + outBegin,
+                compare);
+        }
+    };
+
+    task->runPhase(nbChunks, 1, findSplits, [task, source, destination, compare, width, grainSize, nbChunks, mergeChunks]()->void
+    {
+        task->runPhase(nbChunks, 1, mergeChunks, [task, source, destination, compare, width, grainSize]()->void
+        {
+            mergeRound(task, destination, source, compare, 2 * width, grainSize);
+        } );
+    } );
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+void ParallelSort<TDATA>::radixPass(task_ptr_t task, 
+    data_ptr_t source, 
+    data_ptr_t destination, 
+    const size_t digit, 
+    const size_t grainSize)
+{
+    typedef detail::RadixKey<TDATA> radix_key_t;
+    const size_t radix = 256;
+    if(digit == sizeof(TDATA))
+    {
+        task->finish(source.get());
+        return;
+    }
+
+    auto nbBlocks = (source->size() + grainSize - 1) / grainSize;
+    auto shift = digit * 8;
+    //count of each digit value per block, replaced by the offset each block scatters that digit value to
+    auto offsets = std::make_shared<std::vector<size_t>>(nbBlocks * radix, 0);
+    auto countDigits = [source, offsets, shift, grainSize, radix](const size_t begin, const size_t end)->void
+    {
+        for(size_t block = begin; block < end; ++block)
+        {
+            auto counts = offsets->data() + block * radix;
+            auto last = std::min(source->size(), (block + 1) * grainSize);
+            for(size_t i = block * grainSize; i < last; ++i)
+            {
+                ++counts[(radix_key_t::toKey((*source)[i]) >> shift) & (radix - 1)];
+            }
+        }
+    };
+
+    auto scatter = [source, destination, offsets, shift, grainSize, radix](const size_t begin, const size_t end)->void
+    {
+        for(size_t block = begin; block < end; ++block)
+        {
+            auto blockOffsets = offsets->data() + block * radix;
+            auto last = std::min(source->size(), (block + 1) * grainSize);
+            for(size_t i = block * grainSize; i < last; ++i)
+            {
+                auto& value = (*source)[i];
+                (*destination)[blockOffsets[(radix_key_t::toKey(value) >> shift) & (radix - 1)]++] = std::move(value);
+            }
+        }
+    };
+
+    task->runPhase(nbBlocks, 1, countDigits, [=]()->void
+    {
+        //all data sharing one digit value is already in order for this digit
+        for(size_t value = 0; value < radix; ++value)
+        {
+            size_t total = 0;
+            for(size_t block = 0; block < nbBlocks; ++block)
+            {
+                total += (*offsets)[block * radix + value];
+            }
+            if(total == source->size())
+            {
+                radixPass(task, source, destination, digit + 1, grainSize);
+                return;
+            }
+        }
+
+        //offsets are ordered by digit value, then by block, which keeps the sort stable
+        size_t offset = 0;
+        for(size_t value = 0; value < radix; ++value)
+        {
+            for(size_t block = 0; block < nbBlocks; ++block)
+            {
+                auto& count = (*offsets)[block * radix + value];
+                auto next = offset + count;
+                count = offset;
+                offset = next;
+            }
+        }
+
+        task->runPhase(nbBlocks, 1, scatter, [task, source, destination, digit, grainSize]()->void
+        {
+            radixPass(task, destination, source, digit + 1, grainSize);
+        } );
+    } );
+}
+
+}
+}
\ No newline at end of file
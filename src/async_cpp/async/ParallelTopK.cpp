@@ -0,0 +1,7 @@
+#include "async_cpp/async/ParallelTopK.h"
+
+namespace async_cpp {
+namespace async {
+
+}
+}
@@ -0,0 +1,198 @@
+#pragma once
+#include "async_cpp/async/detail/ReduceTask.h"
+
+#include <algorithm>
+
+namespace async_cpp {
+namespace async {
+
+/**
+ * Select the k greatest items of a set of data in parallel, passing them greatest first to the completion function. 
+ * Each chunk of data keeps a heap bounded to k indices of its best items, and heaps of adjacent chunks are merged down 
+ * to k indices as the chunks combine, so memory used is bounded by k per chunk rather than the size of the data. Items 
+ * which compare equal are kept in data order.
+ */
+//------------------------------------------------------------------------------
+template<class TDATA>
+class ParallelTopK {
+public:
+    typedef typename std::function<bool(const TDATA&, const TDATA&)> compare_t;
+    typedef typename std::function<void(std::exception_ptr, std::vector<TDATA>*)> then_t;
+
+    /**
+     * Create a parallel selection of the k greatest items of data.
+     * @param manager Manager to run tasks against
+     * @param data Data to select from
+     * @param k Largest number of items to select
+     * @param grainSize Largest number of items scanned by a single task, chosen from the data size if zero
+     */
+    ParallelTopK(tasks::ManagerPtr manager, 
+        std::vector<TDATA>&& data,
+        const size_t k,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a parallel selection of the k greatest items of data by a comparison.
+     * @param manager Manager to run tasks against
+     * @param data Data to select from
+     * @param k Largest number of items to select
+     * @param compare Strict weak ordering, true if the first item is less than the second
+     * @param grainSize Largest number of items scanned by a single task, chosen from the data size if zero
+     */
+    ParallelTopK(tasks::ManagerPtr manager, 
+        std::vector<TDATA>&& data,
+        const size_t k,
+        typename compare_t compare,
+        const size_t grainSize = 0);
+
+    /**
+     * Select from the set of data, invoking a task with the selected items
+     * @param onFinishTask Task to run when items have been selected
+     * @return AsyncResult that holds a future completion status, either successful or exception
+     */
+    AsyncResult then(typename then_t onFinishTask);
+
+    /**
+     * Cancel outstanding tasks
+     */
+    void cancel();
+
+private:
+    tasks::ManagerPtr mManager;
+    std::shared_ptr<std::vector<TDATA>> mData;
+    size_t mK;
+    typename compare_t mCompare;
+    size_t mGrainSize;
+    std::vector<std::shared_ptr<detail::IParallelTask<std::vector<size_t>>>> mTasks;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TDATA>
+ParallelTopK<TDATA>::ParallelTopK(tasks::ManagerPtr manager, 
+        std::vector<TDATA>&& data,
+        const size_t k,
+        const size_t grainSize)
+    : ParallelTopK(manager, std::move(data), k, std::less<TDATA>(), grainSize)
+{
+
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+ParallelTopK<TDATA>::ParallelTopK(tasks::ManagerPtr manager, 
+        std::vector<TDATA>&& data,
+        const size_t k,
+        typename compare_t compare,
+        const size_t grainSize)
+    : mManager(manager), 
+      mData(std::make_shared<std::vector<TDATA>>(std::move(data))),
+      mK(k),
+      mCompare(compare),
+      mGrainSize(grainSize)
+{
+    if(!mManager) { throw(std::invalid_argument("ParallelTopK: Manager cannot be null")); }
+    if(!mCompare) { throw(std::invalid_argument("ParallelTopK: Compare operation cannot be null")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mData->size()); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+AsyncResult ParallelTopK<TDATA>::then(typename then_t onFinishOp)
+{
+    auto data = mData;
+    auto terminalTask(std::make_shared<detail::ReduceCollectTask<std::vector<size_t>>>(mManager, 
+        [data, onFinishOp](std::exception_ptr ex, std::vector<size_t>* indices)->void
+    {
+        if(!indices)
+        {
+            onFinishOp(ex, nullptr);
+            return;
+        }
+
+        std::vector<TDATA> selected;
+        selected.reserve(indices->size());
+        for(auto index : *indices)
+        {
+            selected.emplace_back(std::move((*data)[index]));
+        }
+        onFinishOp(ex, &selected);
+    } ));
+    auto result = terminalTask->result();
+
+    //rank indices by item, with earlier indices ranking higher among equal items
+    auto compare = mCompare;
+    auto isBetter = [data, compare](const size_t left, const size_t right)->bool
+    {
+        const auto& leftItem = (*data)[left];
+        const auto& rightItem = (*data)[right];
+        if(compare(rightItem, leftItem)) return true;
+        return !compare(leftItem, rightItem) && left < right;
+    };
+
+    const auto k = mK;
+    auto op = [k, isBetter](const size_t begin, const size_t end)->std::vector<size_t>
+    {
+        //heap ordered so its worst index is at the front, ready to be replaced
+        std::vector<size_t> heap;
+        if(0 == k) return heap;
+        heap.reserve(std::min(k, end - begin));
+        for(size_t i = begin; i < end; ++i)
+        {
+            if(heap.size() < k)
+            {
+                heap.push_back(i);
+                std::push_heap(heap.begin(), heap.end(), isBetter);
+            }
+            else if(isBetter(i, heap.front()))
+            {
+                std::pop_heap(heap.begin(), heap.end(), isBetter);
+                heap.back() = i;
+                std::push_heap(heap.begin(), heap.end(), isBetter);
+            }
+        }
+        std::sort_heap(heap.begin(), heap.end(), isBetter);
+        return heap;
+    };
+
+    auto combineOp = [k, isBetter](std::vector<size_t>&& left, std::vector<size_t>&& right)->std::vector<size_t>
+    {
+        std::vector<size_t> merged;
+        merged.reserve(std::min(k, left.size() + right.size()));
+        auto leftIt = left.begin();
+        auto rightIt = right.begin();
+        while(merged.size() < k && (leftIt != left.end() || rightIt != right.end()))
+        {
+            if(rightIt == right.end() || (leftIt != left.end() && isBetter(*leftIt, *rightIt)))
+            {
+                merged.push_back(*leftIt++);
+            }
+            else
+            {
+                merged.push_back(*rightIt++);
+            }
+        }
+        return merged;
+    };
+
+    auto task = std::make_shared<detail::ReduceTask<std::vector<size_t>>>(mManager, op, combineOp, 
+        detail::BlockedRange(0, mData->size(), mGrainSize), terminalTask);
+    mTasks.emplace_back(terminalTask);
+    mTasks.emplace_back(task);
+    mManager->run(task);
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+void ParallelTopK<TDATA>::cancel()
+{
+    for(auto task : mTasks)
+    {
+        task->cancel();
+    }
+}
+
+}
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+#include "async_cpp/async/Pipeline.h"
+
+namespace async_cpp {
+namespace async {
+
+}
+}
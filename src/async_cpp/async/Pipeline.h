@@ -0,0 +1,265 @@
+#pragma once
+#include "async_cpp/async/ParallelReduce.h"
+#include "async_cpp/async/detail/PhasedTask.h"
+#include "async_cpp/async/detail/ReduceTask.h"
+
+#include <vector>
+
+namespace async_cpp {
+namespace async {
+
+/**
+ * Lazily composed chain of map and filter stages over a set of data, ending in a reduction or collection. Stages do not 
+ * run until a terminal operation is called, and are then fused: each chunk of data is passed through every stage in one 
+ * pass by a single task, so no intermediate sets of data are built between stages. Data is not consumed, so a pipeline 
+ * can be run more than once.
+ */
+//------------------------------------------------------------------------------
+template<class TSOURCE, class TDATA = TSOURCE>
+class Pipeline {
+public:
+    typedef std::function<void(const TDATA&)> sink_t;
+    typedef std::function<void(const size_t, const size_t, const sink_t&)> source_t;
+    typedef typename std::function<bool(const TDATA&)> filter_t;
+    typedef typename detail::ReduceTask<TDATA>::combine_t combine_t;
+    typedef typename detail::ReduceCollectTask<TDATA>::then_t reduce_then_t;
+    typedef typename std::function<void(std::exception_ptr, std::vector<TDATA>&&)> then_t;
+
+    /**
+     * Create a pipeline over a set of data.
+     * @param manager Manager to run tasks against
+     * @param data Data to pass through pipeline
+     * @param grainSize Largest number of items passed through all stages by a single task, chosen from the data size if zero
+     * @param mode How chunks are chosen when no grain size is given, deterministic mode making reductions reproducible
+     */
+    Pipeline(tasks::ManagerPtr manager, 
+        std::vector<TSOURCE>&& data, 
+        const size_t grainSize = 0, 
+        const ReduceMode mode = ReduceMode::Fast);
+
+    /**
+     * Add a stage mapping each item to a new value.
+     * @param mapOp Operation producing a new value from an item
+     * @return Pipeline with map stage added
+     */
+    template<class TRESULT>
+    Pipeline<TSOURCE, TRESULT> map(std::function<TRESULT(const TDATA&)> mapOp) const;
+
+    /**
+     * Add a stage keeping only items which pass a criteria.
+     * @param filterOp Operation returning true for items to keep
+     * @return Pipeline with filter stage added
+     */
+    Pipeline filter(typename filter_t filterOp) const;
+
+    /**
+     * Run the pipeline, reducing the items leaving the last stage to a single value. Each chunk reduces its items from 
+     * the identity, and partial results are combined in a tree as by ParallelReduce.
+     * @param identity Value each chunk starts accumulating from, and the result if no items leave the pipeline
+     * @param combineOp Associative operation combining two values, with values from earlier data on the left
+     * @param onReduce Function to invoke with the reduced value
+     * @return AsyncResult that holds a future completion status, either successful or exception
+     */
+    AsyncResult reduce(const TDATA& identity, typename combine_t combineOp, typename reduce_then_t onReduce);
+
+    /**
+     * Run the pipeline, collecting the items leaving the last stage in their original order. Items must be default 
+     * constructible.
+     * @param onCollect Function to invoke with the collected items
+     * @return AsyncResult that holds a future completion status, either successful or exception
+     */
+    AsyncResult collect(typename then_t onCollect);
+
+    /**
+     * Cancel outstanding tasks of a running terminal operation
+     */
+    void cancel();
+
+private:
+    template<class TOTHERSOURCE, class TOTHERDATA> friend class Pipeline;
+
+    Pipeline(tasks::ManagerPtr manager, 
+        std::shared_ptr<std::vector<TSOURCE>> data, 
+        const size_t grainSize, 
+        source_t source);
+
+    tasks::ManagerPtr mManager;
+    std::shared_ptr<std::vector<TSOURCE>> mData;
+    size_t mGrainSize;
+    source_t mSource;
+    std::vector<std::shared_ptr<tasks::Task>> mTasks;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TSOURCE, class TDATA>
+Pipeline<TSOURCE, TDATA>::Pipeline(tasks::ManagerPtr manager, 
+        std::vector<TSOURCE>&& data, 
+        const size_t grainSize, 
+        const ReduceMode mode)
+    : mManager(manager), mData(std::make_shared<std::vector<TSOURCE>>(std::move(data))), mGrainSize(grainSize)
+{
+    static_assert(std::is_same<TSOURCE, TDATA>::value, "Pipeline: Data must start as the source type");
+    if(!mManager) { throw(std::invalid_argument("Pipeline: Manager cannot be null")); }
+    if(0 == mGrainSize)
+    {
+        mGrainSize = (ReduceMode::Deterministic == mode) ? detail::BlockedRange::deterministicGrainSize(mData->size()) 
+            : detail::BlockedRange::defaultGrainSize(mData->size());
+    }
+
+    auto sourceData = mData;
+    mSource = [sourceData](const size_t begin, const size_t end, const sink_t& sink)->void
+    {
+        for(size_t i = begin; i < end; ++i)
+        {
+            sink((*sourceData)[i]);
+        }
+    };
+}
+
+//------------------------------------------------------------------------------
+template<class TSOURCE, class TDATA>
+Pipeline<TSOURCE, TDATA>::Pipeline(tasks::ManagerPtr manager, 
+        std::shared_ptr<std::vector<TSOURCE>> data, 
+        const size_t grainSize, 
+        source_t source)
+    : mManager(manager), mData(data), mGrainSize(grainSize), mSource(source)
+{
+
+}
+
+//------------------------------------------------------------------------------
+template<class TSOURCE, class TDATA>
+template<class TRESULT>
+Pipeline<TSOURCE, TRESULT> Pipeline<TSOURCE, TDATA>::map(std::function<TRESULT(const TDATA&)> mapOp) const
+{
+    if(!mapOp) { throw(std::invalid_argument("Pipeline: Map operation cannot be null")); }
+    auto previous = mSource;
+    typename Pipeline<TSOURCE, TRESULT>::source_t source = [previous, mapOp](const size_t begin, 
+        const size_t end, 
+        const typename Pipeline<TSOURCE, TRESULT>::sink_t& sink)->void
+    {
+        previous(begin, end, [&mapOp, &sink](const TDATA& value)->void
+        {
+            sink(mapOp(value));
+        } );
+    };
+    return Pipeline<TSOURCE, TRESULT>(mManager, mData, mGrainSize, source);
+}
+
+//------------------------------------------------------------------------------
+template<class TSOURCE, class TDATA>
+Pipeline<TSOURCE, TDATA> Pipeline<TSOURCE, TDATA>::filter(typename filter_t filterOp) const
+{
+    if(!filterOp) { throw(std::invalid_argument("Pipeline: Filter operation cannot be null")); }
+    auto previous = mSource;
+    source_t source = [previous, filterOp](const size_t begin, const size_t end, const sink_t& sink)->void
+    {
+        previous(begin, end, [&filterOp, &sink](const TDATA& value)->void
+        {
+            if(filterOp(value)) sink(value);
+        } );
+    };
+    return Pipeline(mManager, mData, mGrainSize, source);
+}
+
+//------------------------------------------------------------------------------
+template<class TSOURCE, class TDATA>
+AsyncResult Pipeline<TSOURCE, TDATA>::reduce(const TDATA& identity, 
+    typename combine_t combineOp, 
+    typename reduce_then_t onReduce)
+{
+    if(!combineOp) { throw(std::invalid_argument("Pipeline: Combine operation cannot be null")); }
+    auto terminalTask(std::make_shared<detail::ReduceCollectTask<TDATA>>(mManager, onReduce));
+    auto result = terminalTask->result();
+
+    auto source = mSource;
+    auto op = [source, identity, combineOp](const size_t begin, const size_t end)->TDATA
+    {
+        auto partial = identity;
+        source(begin, end, [&partial, &combineOp](const TDATA& value)->void
+        {
+            partial = combineOp(std::move(partial), TDATA(value));
+        } );
+        return partial;
+    };
+
+    auto task = std::make_shared<detail::ReduceTask<TDATA>>(mManager, op, combineOp, 
+        detail::BlockedRange(0, mData->size(), mGrainSize), terminalTask);
+    mTasks.emplace_back(terminalTask);
+    mTasks.emplace_back(task);
+    mManager->run(task);
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TSOURCE, class TDATA>
+AsyncResult Pipeline<TSOURCE, TDATA>::collect(typename then_t onCollect)
+{
+    auto task = std::make_shared<detail::PhasedTask<std::vector<TDATA>>>(mManager, 
+        [onCollect](std::exception_ptr ex, std::vector<TDATA>* results)->void
+        {
+            if(onCollect) onCollect(ex, results ? std::move(*results) : std::vector<TDATA>());
+        } );
+    mTasks.emplace_back(task);
+    auto result = task->result();
+
+    auto source = mSource;
+    auto grainSize = mGrainSize;
+    auto size = mData->size();
+    auto nbBlocks = (size + grainSize - 1) / grainSize;
+    auto blocks = std::make_shared<std::vector<std::vector<TDATA>>>(nbBlocks);
+    auto runBlocks = [source, blocks, grainSize, size](const size_t begin, const size_t end)->void
+    {
+        for(size_t block = begin; block < end; ++block)
+        {
+            auto& items = (*blocks)[block];
+            source(block * grainSize, std::min(size, (block + 1) * grainSize), [&items](const TDATA& value)->void
+            {
+                items.push_back(value);
+            } );
+        }
+    };
+
+    task->runPhase(nbBlocks, 1, runBlocks, [task, blocks, nbBlocks]()->void
+    {
+        auto offsets = std::make_shared<std::vector<size_t>>(nbBlocks, 0);
+        size_t total = 0;
+        for(size_t block = 0; block < nbBlocks; ++block)
+        {
+            (*offsets)[block] = total;
+            total += (*blocks)[block].size();
+        }
+
+        auto output = std::make_shared<std::vector<TDATA>>(total);
+        auto moveBlocks = [blocks, offsets, output](const size_t begin, const size_t end)->void
+        {
+            for(size_t block = begin; block < end; ++block)
+            {
+                auto& items = (*blocks)[block];
+                std::move(items.begin(), items.end(), output->begin() + (*offsets)[block]);
+                std::vector<TDATA>().swap(items);
+            }
+        };
+        task->runPhase(nbBlocks, 1, moveBlocks, [task, output]()->void
+        {
+            task->finish(output.get());
+        } );
+    } );
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TSOURCE, class TDATA>
+void Pipeline<TSOURCE, TDATA>::cancel()
+{
+    for(auto task : mTasks)
+    {
+        task->cancel();
+    }
+}
+
+}
+}
\ No newline at end of file
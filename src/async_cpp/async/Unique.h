@@ -1,20 +1,28 @@
 #pragma once
 #include "async_cpp/async/Async.h"
 #include "async_cpp/async/ParallelFor.h"
+#include "async_cpp/async/ParallelSort.h"
+#include "async_cpp/async/detail/Compaction.h"
+#include "async_cpp/async/detail/HashPartition.h"
 
+#include <cstdint>
+#include <unordered_set>
 #include <vector>
 
 namespace async_cpp {
 namespace async {
 
 /**
- * Find unique results in a set of data using a comparison operator
+ * Find unique results in a set of data, keeping the first occurrence of each in its original order. Uniqueness can be 
+ * found by hashing, by sorting with operator<, or by comparing every pair of data with an equality operator, which 
+ * takes quadratic time and is only suited to small sets of data.
  */
 //------------------------------------------------------------------------------
 template<class TDATA>
 class Unique {
 public:
     typedef typename std::function<bool(const TDATA&, const TDATA&)> equal_op_t;
+    typedef typename std::function<size_t(const TDATA&)> hash_op_t;
     typedef typename ParallelFor<TDATA>::then_t then_t;
     /**
      * Create a filter operation that will filter a set of data based on an operation.
@@ -26,6 +34,32 @@ public:
         typename equal_op_t equalOp,
         std::vector<TDATA>&& data);
 
+    /**
+     * Create a uniqueness operation which hashes data. Data is hashed in parallel and split into partitions by hash, 
+     * then each partition finds its first occurrences with its own hash set, in parallel.
+     * @param manager Manager to use with uniqueness operation
+     * @param hashOp Operation to hash data, equal data must have equal hashes
+     * @param equalOp Operation to use to determine if two data points are equal
+     * @param data Data to be filtered
+     * @param grainSize Number of items in each block, chosen from the data size if zero
+     */
+    Unique(tasks::ManagerPtr manager, 
+        typename hash_op_t hashOp,
+        typename equal_op_t equalOp,
+        std::vector<TDATA>&& data,
+        const size_t grainSize = 0);
+
+    /**
+     * Create a uniqueness operation which sorts data with operator<. Data is stably sorted in parallel, and the first of 
+     * each run of equivalent data is kept.
+     * @param manager Manager to use with uniqueness operation
+     * @param data Data to be filtered
+     * @param grainSize Number of items in each block, chosen from the data size if zero
+     */
+    Unique(tasks::ManagerPtr manager, 
+        std::vector<TDATA>&& data,
+        const size_t grainSize = 0);
+
     /**
      * Run the operation across the set of data, invoking a task with the unique results
      * @param onUnique Function to invoke when uniqueness operation is complete, receiving unique data
@@ -38,10 +72,24 @@ public:
     void cancel();
 
 private:
+    typedef std::shared_ptr<detail::PhasedTask<std::vector<TDATA>>> task_ptr_t;
+    typedef AsyncResult (Unique::*strategy_t)(typename then_t);
+
+    AsyncResult thenCompared(typename then_t onUnique);
+    AsyncResult thenHashed(typename then_t onUnique);
+    AsyncResult thenSorted(typename then_t onUnique);
+    task_ptr_t createTask(typename then_t onUnique);
+
+    //chosen by constructor, so operator< is only required when sorting
+    strategy_t mStrategy;
     typename equal_op_t mOp;
+    typename hash_op_t mHashOp;
     tasks::ManagerPtr mManager;
     std::vector<TDATA> mData;
+    size_t mGrainSize;
     std::shared_ptr<ParallelFor<TDATA>> mParallel;
+    std::shared_ptr<ParallelSort<size_t>> mSort;
+    std::shared_ptr<tasks::Task> mTask;
 };
 
 //inline implementations
@@ -50,15 +98,51 @@ template<class TDATA>
 Unique<TDATA>::Unique(tasks::ManagerPtr manager, 
                       typename equal_op_t equalOp, 
                       std::vector<TDATA>&& data)
-    : mManager(manager), mOp(equalOp), mData(std::move(data))
+    : mStrategy(&Unique::thenCompared), mManager(manager), mOp(equalOp), mData(std::move(data)), mGrainSize(0)
+{
+    if(!mManager) { throw(std::invalid_argument("Unique: Manager cannot be null")); }
+    if(mData.empty()) { throw(std::invalid_argument("Unique: Empty data set")); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+Unique<TDATA>::Unique(tasks::ManagerPtr manager, 
+                      typename hash_op_t hashOp, 
+                      typename equal_op_t equalOp, 
+                      std::vector<TDATA>&& data,
+                      const size_t grainSize)
+    : mStrategy(&Unique::thenHashed), mManager(manager), mOp(equalOp), mHashOp(hashOp), mData(std::move(data)), 
+      mGrainSize(grainSize)
 {
     if(!mManager) { throw(std::invalid_argument("Unique: Manager cannot be null")); }
+    if(!mHashOp) { throw(std::invalid_argument("Unique: Hash operation cannot be null")); }
+    if(!mOp) { throw(std::invalid_argument("Unique: Equal operation cannot be null")); }
     if(mData.empty()) { throw(std::invalid_argument("Unique: Empty data set")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mData.size()); }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+Unique<TDATA>::Unique(tasks::ManagerPtr manager, 
+                      std::vector<TDATA>&& data,
+                      const size_t grainSize)
+    : mStrategy(&Unique::thenSorted), mManager(manager), mData(std::move(data)), mGrainSize(grainSize)
+{
+    if(!mManager) { throw(std::invalid_argument("Unique: Manager cannot be null")); }
+    if(mData.empty()) { throw(std::invalid_argument("Unique: Empty data set")); }
+    if(0 == mGrainSize) { mGrainSize = detail::BlockedRange::defaultGrainSize(mData.size()); }
 }
 
 //------------------------------------------------------------------------------
 template<class TDATA>
 AsyncResult Unique<TDATA>::then(typename then_t onUnique)
+{
+    return (this->*mStrategy)(onUnique);
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+AsyncResult Unique<TDATA>::thenCompared(typename then_t onUnique)
 {
     auto forSize = mData.size();
     auto saveData = std::make_shared<std::vector<TDATA>>(std::move(mData));
@@ -85,6 +169,144 @@ template<class TDATA>
 void Unique<TDATA>::cancel()
 {
     if(mParallel) mParallel->cancel();
+    if(mSort) mSort->cancel();
+    if(mTask) mTask->cancel();
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+typename Unique<TDATA>::task_ptr_t Unique<TDATA>::createTask(typename then_t onUnique)
+{
+    auto task = std::make_shared<detail::PhasedTask<std::vector<TDATA>>>(mManager, 
+        [onUnique](std::exception_ptr ex, std::vector<TDATA>* results)->void
+        {
+            onUnique(ex, results ? std::move(*results) : std::vector<TDATA>());
+        } );
+    mTask = task;
+    return task;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+AsyncResult Unique<TDATA>::thenHashed(typename then_t onUnique)
+{
+    auto task = createTask(onUnique);
+    auto result = task->result();
+
+    auto data = std::make_shared<std::vector<TDATA>>(std::move(mData));
+    auto hashOp = mHashOp;
+    auto equalOp = mOp;
+    auto grainSize = mGrainSize;
+    auto nbBlocks = (data->size() + grainSize - 1) / grainSize;
+    auto nbPartitions = detail::partitionCount(nbBlocks);
+    auto hashes = std::make_shared<std::vector<size_t>>(data->size());
+    //indices of data for each block and partition, in order, so each partition sees data in its original order
+    auto partitions = std::make_shared<std::vector<std::vector<size_t>>>(nbBlocks * nbPartitions);
+    auto keep = std::make_shared<std::vector<uint8_t>>(data->size(), 0);
+
+    auto hashBlocks = [data, hashOp, hashes, partitions, nbPartitions, grainSize](const size_t begin, const size_t end)->void
+    {
+        for(size_t block = begin; block < end; ++block)
+        {
+            auto last = std::min(data->size(), (block + 1) * grainSize);
+            for(size_t i = block * grainSize; i < last; ++i)
+            {
+                auto hash = hashOp((*data)[i]);
+                (*hashes)[i] = hash;
+                (*partitions)[block * nbPartitions + detail::partitionOf(hash, nbPartitions)].push_back(i);
+            }
+        }
+    };
+
+    auto findFirsts = [data, equalOp, hashes, partitions, keep, nbBlocks, nbPartitions](const size_t begin, const size_t end)->void
+    {
+        std::function<size_t(const size_t)> indexHash = [hashes](const size_t index)->size_t
+        {
+            return (*hashes)[index];
+        };
+        std::function<bool(const size_t, const size_t)> indexEqual = [data, equalOp](const size_t left, const size_t right)->bool
+        {
+            return equalOp((*data)[left], (*data)[right]);
+        };
+        for(size_t partition = begin; partition < end; ++partition)
+        {
+            std::unordered_set<size_t, std::function<size_t(const size_t)>, std::function<bool(const size_t, const size_t)>> seen(
+                0, indexHash, indexEqual);
+            for(size_t block = 0; block < nbBlocks; ++block)
+            {
+                auto& indices = (*partitions)[block * nbPartitions + partition];
+                for(auto index : indices)
+                {
+                    if(seen.insert(index).second) (*keep)[index] = 1;
+                }
+                std::vector<size_t>().swap(indices);
+            }
+        }
+    };
+
+    task->runPhase(nbBlocks, 1, hashBlocks, [task, data, keep, grainSize, nbPartitions, findFirsts]()->void
+    {
+        task->runPhase(nbPartitions, 1, findFirsts, [task, data, keep, grainSize]()->void
+        {
+            detail::compact<TDATA>(task, data, keep, grainSize, [task](std::shared_ptr<std::vector<TDATA>> results)->void
+            {
+                task->finish(results.get());
+            } );
+        } );
+    } );
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+AsyncResult Unique<TDATA>::thenSorted(typename then_t onUnique)
+{
+    auto task = createTask(onUnique);
+    auto result = task->result();
+
+    auto data = std::make_shared<std::vector<TDATA>>(std::move(mData));
+    auto grainSize = mGrainSize;
+    std::vector<size_t> indices(data->size());
+    for(size_t i = 0; i < indices.size(); ++i)
+    {
+        indices[i] = i;
+    }
+
+    //a stable sort of indices leaves the first occurrence at the start of each run of equivalent data
+    auto compare = [data](const size_t& left, const size_t& right)->bool
+    {
+        return (*data)[left] < (*data)[right];
+    };
+    mSort = std::make_shared<ParallelSort<size_t>>(mManager, std::move(indices), compare, grainSize);
+    mSort->then([task, data, grainSize](std::exception_ptr ex, std::vector<size_t>* sorted)->void
+    {
+        if(ex)
+        {
+            task->notifyException(ex);
+            return;
+        }
+
+        auto order = std::make_shared<std::vector<size_t>>(std::move(*sorted));
+        auto keep = std::make_shared<std::vector<uint8_t>>(data->size(), 0);
+        auto markFirsts = [data, order, keep](const size_t begin, const size_t end)->void
+        {
+            for(size_t i = begin; i < end; ++i)
+            {
+                auto index = (*order)[i];
+                (*keep)[index] = (0 == i || (*data)[(*order)[i - 1]] < (*data)[index]) ? 1 : 0;
+            }
+        };
+        task->runPhase(data->size(), grainSize, markFirsts, [task, data, keep, grainSize]()->void
+        {
+            detail::compact<TDATA>(task, data, keep, grainSize, [task](std::shared_ptr<std::vector<TDATA>> results)->void
+            {
+                task->finish(results.get());
+            } );
+        } );
+    } );
+
+    return result;
 }
 
 }
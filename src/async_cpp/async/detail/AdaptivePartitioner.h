@@ -0,0 +1,128 @@
+#pragma once
+#include "async_cpp/async/Async.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Chunk size tuning shared by the range tasks of one operation. Each chunk run is timed, and the chunk size grown or
+ * shrunk towards the size expected to run for a target duration. Ranges are only split again once every previously
+ * split half has been taken by a worker, so splitting happens when workers are idle rather than up front.
+ */
+//------------------------------------------------------------------------------
+class AdaptivePartitioner {
+public:
+    /**
+     * Create a partitioner tuning chunks towards a target duration.
+     * @param target Duration each chunk should take to run
+     */
+    inline AdaptivePartitioner(const std::chrono::nanoseconds target);
+
+    /**
+     * Target chunk duration used when none is given, long enough to hide the cost of queueing a task.
+     * @return Default target duration
+     */
+    static inline std::chrono::nanoseconds defaultTarget();
+
+    /**
+     * Number of indices the next chunk should run.
+     * @return Chunk size of at least one
+     */
+    inline size_t chunkSize() const;
+
+    /**
+     * Adjust the chunk size from the time taken to run a chunk. Growth and shrinkage are limited to a factor of two per
+     * chunk, so a single outlier does not swing the chunk size.
+     * @param size Number of indices run
+     * @param elapsed Time taken to run them
+     */
+    inline void record(const size_t size, const std::chrono::nanoseconds elapsed);
+
+    /**
+     * Check if a range should split off another half, which is only when no split half is waiting for a worker.
+     * @return True if workers have taken all split halves
+     */
+    inline bool shouldSplit() const;
+
+    /**
+     * Note that a range task has been queued.
+     */
+    inline void queued();
+
+    /**
+     * Note that a queued range task has been taken by a worker.
+     */
+    inline void started();
+
+private:
+    std::chrono::nanoseconds mTarget;
+    std::atomic<size_t> mChunkSize;
+    std::atomic<size_t> mPending;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+AdaptivePartitioner::AdaptivePartitioner(const std::chrono::nanoseconds target)
+    : mTarget(target)
+{
+    if(mTarget.count() <= 0) { throw(std::invalid_argument("AdaptivePartitioner: Target duration must be positive")); }
+    mChunkSize.store(1);
+    mPending.store(0);
+}
+
+//------------------------------------------------------------------------------
+std::chrono::nanoseconds AdaptivePartitioner::defaultTarget()
+{
+    return std::chrono::microseconds(50);
+}
+
+//------------------------------------------------------------------------------
+size_t AdaptivePartitioner::chunkSize() const
+{
+    return mChunkSize.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void AdaptivePartitioner::record(const size_t size, const std::chrono::nanoseconds elapsed)
+{
+    if(0 == size) return;
+
+    //too quick to measure, grow as far as allowed
+    size_t ideal = 2 * size;
+    if(elapsed.count() > 0)
+    {
+        auto scaled = static_cast<double>(size) * mTarget.count() / elapsed.count();
+        ideal = static_cast<size_t>(std::min(scaled, static_cast<double>(2 * size)));
+    }
+    ideal = std::max<size_t>(std::max<size_t>(1, size / 2), ideal);
+    mChunkSize.store(ideal, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+bool AdaptivePartitioner::shouldSplit() const
+{
+    return 0 == mPending.load();
+}
+
+//------------------------------------------------------------------------------
+void AdaptivePartitioner::queued()
+{
+    ++mPending;
+}
+
+//------------------------------------------------------------------------------
+void AdaptivePartitioner::started()
+{
+    --mPending;
+}
+
+}
+}
+}
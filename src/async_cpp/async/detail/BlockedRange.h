@@ -0,0 +1,129 @@
+#pragma once
+#include "async_cpp/async/Async.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Half open range of indices [begin, end), which can be split in half until it is no larger than a grain size.
+ */
+//------------------------------------------------------------------------------
+class BlockedRange {
+public:
+    /**
+     * Create a range of indices.
+     * @param begin First index in range
+     * @param end One past the last index in range
+     * @param grainSize Size at which range will no longer be split
+     */
+    inline BlockedRange(const size_t begin, const size_t end, const size_t grainSize);
+
+    /**
+     * Choose a grain size for a number of indices, giving a few chunks per hardware thread.
+     * @param size Number of indices to be split
+     * @return Grain size of at least one
+     */
+    static inline size_t defaultGrainSize(const size_t size);
+
+    /**
+     * Choose a grain size for a number of indices from the size alone, so ranges split into the same chunks on any 
+     * machine regardless of its number of hardware threads.
+     * @param size Number of indices to be split
+     * @return Grain size of at least one
+     */
+    static inline size_t deterministicGrainSize(const size_t size);
+
+    inline size_t begin() const;
+    inline size_t end() const;
+    inline size_t size() const;
+    inline size_t grainSize() const;
+
+    /**
+     * Check if this range is larger than its grain size, and can be split.
+     * @return True if range can be split
+     */
+    inline bool isDivisible() const;
+
+    /**
+     * Split this range in half, keeping the lower half.
+     * @return Upper half of range
+     */
+    inline BlockedRange split();
+
+private:
+    size_t mBegin;
+    size_t mEnd;
+    size_t mGrainSize;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+BlockedRange::BlockedRange(const size_t begin, const size_t end, const size_t grainSize)
+    : mBegin(begin), mEnd(end), mGrainSize(grainSize)
+{
+    if(mEnd < mBegin) { throw(std::invalid_argument("BlockedRange: End before begin")); }
+    if(0 == mGrainSize) { throw(std::invalid_argument("BlockedRange: Grain size must be at least one")); }
+}
+
+//------------------------------------------------------------------------------
+size_t BlockedRange::defaultGrainSize(const size_t size)
+{
+    const size_t chunks = 4 * std::max(1u, std::thread::hardware_concurrency());
+    return std::max<size_t>(1, size / chunks);
+}
+
+//------------------------------------------------------------------------------
+size_t BlockedRange::deterministicGrainSize(const size_t size)
+{
+    const size_t chunks = 64;
+    return std::max<size_t>(1, size / chunks);
+}
+
+//------------------------------------------------------------------------------
+size_t BlockedRange::begin() const
+{
+    return mBegin;
+}
+
+//------------------------------------------------------------------------------
+size_t BlockedRange::end() const
+{
+    return mEnd;
+}
+
+//------------------------------------------------------------------------------
+size_t BlockedRange::size() const
+{
+    return mEnd - mBegin;
+}
+
+//------------------------------------------------------------------------------
+size_t BlockedRange::grainSize() const
+{
+    return mGrainSize;
+}
+
+//------------------------------------------------------------------------------
+bool BlockedRange::isDivisible() const
+{
+    return size() > mGrainSize;
+}
+
+//------------------------------------------------------------------------------
+BlockedRange BlockedRange::split()
+{
+    auto middle = mBegin + size() / 2;
+    BlockedRange upper(middle, mEnd, mGrainSize);
+    mEnd = middle;
+    return upper;
+}
+
+}
+}
+}
\ No newline at end of file
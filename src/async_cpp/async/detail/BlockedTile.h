@@ -0,0 +1,220 @@
+#pragma once
+#include "async_cpp/async/detail/BlockedRange.h"
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Tile of a multi-dimensional set of indices, holding a blocked range per dimension. A tile is split in half along its 
+ * longest divisible dimension until every dimension is no larger than its grain size, so split tiles stay close to the 
+ * shape of the grain sizes.
+ */
+//------------------------------------------------------------------------------
+template<size_t DIMS>
+class BlockedTile {
+public:
+    /**
+     * Create a tile from a range per dimension.
+     * @param ranges Range of indices in each dimension, the last dimension being contiguous
+     */
+    BlockedTile(const std::array<BlockedRange, DIMS>& ranges);
+
+    /**
+     * Create a tile from the bounds of each dimension.
+     * @param begins First index in each dimension
+     * @param ends One past the last index in each dimension
+     * @param grainSizes Size at which each dimension will no longer be split
+     */
+    BlockedTile(const std::array<size_t, DIMS>& begins, 
+        const std::array<size_t, DIMS>& ends, 
+        const std::array<size_t, DIMS>& grainSizes);
+
+    /**
+     * Get the range of indices of a dimension.
+     * @param dimension Dimension of range
+     * @return Range of indices
+     */
+    const BlockedRange& operator[](const size_t dimension) const;
+
+    /**
+     * Get the number of indices covered by this tile.
+     * @return Product of the sizes of each dimension
+     */
+    size_t size() const;
+
+    /**
+     * Get the row major index of the first item of this tile, within a set of indices.
+     * @param extents Size of each dimension of the whole set of indices
+     * @return Row major index of first item
+     */
+    size_t index(const std::array<size_t, DIMS>& extents) const;
+
+    /**
+     * Check if any dimension of this tile is larger than its grain size, and can be split.
+     * @return True if tile can be split
+     */
+    bool isDivisible() const;
+
+    /**
+     * Split this tile in half along its longest divisible dimension, keeping the lower half.
+     * @return Upper half of tile
+     */
+    BlockedTile split();
+
+private:
+    template<class... TRANGES>
+    static std::array<BlockedRange, DIMS> makeRanges(const std::array<size_t, DIMS>& begins, 
+        const std::array<size_t, DIMS>& ends, 
+        const std::array<size_t, DIMS>& grainSizes,
+        std::true_type,
+        TRANGES... ranges);
+
+    template<class... TRANGES>
+    static std::array<BlockedRange, DIMS> makeRanges(const std::array<size_t, DIMS>& begins, 
+        const std::array<size_t, DIMS>& ends, 
+        const std::array<size_t, DIMS>& grainSizes,
+        std::false_type,
+        TRANGES... ranges);
+
+    std::array<BlockedRange, DIMS> mRanges;
+};
+
+/**
+ * Interleave the bits of coordinates into a Morton (Z-order) code, so coordinates close in every dimension have close 
+ * codes.
+ * @param coordinates Coordinate in each dimension
+ * @return Morton code of coordinates
+ */
+template<size_t DIMS>
+inline uint64_t mortonCode(const std::array<size_t, DIMS>& coordinates);
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<size_t DIMS>
+BlockedTile<DIMS>::BlockedTile(const std::array<BlockedRange, DIMS>& ranges)
+    : mRanges(ranges)
+{
+
+}
+
+//------------------------------------------------------------------------------
+template<size_t DIMS>
+BlockedTile<DIMS>::BlockedTile(const std::array<size_t, DIMS>& begins, 
+        const std::array<size_t, DIMS>& ends, 
+        const std::array<size_t, DIMS>& grainSizes)
+    : mRanges(makeRanges(begins, ends, grainSizes, std::integral_constant<bool, 0 == DIMS>()))
+{
+
+}
+
+//------------------------------------------------------------------------------
+template<size_t DIMS>
+template<class... TRANGES>
+std::array<BlockedRange, DIMS> BlockedTile<DIMS>::makeRanges(const std::array<size_t, DIMS>& begins, 
+        const std::array<size_t, DIMS>& ends, 
+        const std::array<size_t, DIMS>& grainSizes,
+        std::true_type,
+        TRANGES... ranges)
+{
+    return {{ ranges... }};
+}
+
+//------------------------------------------------------------------------------
+template<size_t DIMS>
+template<class... TRANGES>
+std::array<BlockedRange, DIMS> BlockedTile<DIMS>::makeRanges(const std::array<size_t, DIMS>& begins, 
+        const std::array<size_t, DIMS>& ends, 
+        const std::array<size_t, DIMS>& grainSizes,
+        std::false_type,
+        TRANGES... ranges)
+{
+    //ranges have no default value, so are appended one dimension at a time until every dimension has a range
+    const size_t next = sizeof...(TRANGES);
+    return makeRanges(begins, ends, grainSizes, std::integral_constant<bool, next + 1 == DIMS>(), 
+        ranges..., BlockedRange(begins[next], ends[next], grainSizes[next]));
+}
+
+//------------------------------------------------------------------------------
+template<size_t DIMS>
+const BlockedRange& BlockedTile<DIMS>::operator[](const size_t dimension) const
+{
+    return mRanges[dimension];
+}
+
+//------------------------------------------------------------------------------
+template<size_t DIMS>
+size_t BlockedTile<DIMS>::size() const
+{
+    size_t size = 1;
+    for(auto& range : mRanges)
+    {
+        size *= range.size();
+    }
+    return size;
+}
+
+//------------------------------------------------------------------------------
+template<size_t DIMS>
+size_t BlockedTile<DIMS>::index(const std::array<size_t, DIMS>& extents) const
+{
+    size_t index = 0;
+    for(size_t dimension = 0; dimension < DIMS; ++dimension)
+    {
+        index = index * extents[dimension] + mRanges[dimension].begin();
+    }
+    return index;
+}
+
+//------------------------------------------------------------------------------
+template<size_t DIMS>
+bool BlockedTile<DIMS>::isDivisible() const
+{
+    for(auto& range : mRanges)
+    {
+        if(range.isDivisible()) return true;
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+template<size_t DIMS>
+BlockedTile<DIMS> BlockedTile<DIMS>::split()
+{
+    size_t longest = 0;
+    for(size_t dimension = 1; dimension < DIMS; ++dimension)
+    {
+        if(mRanges[dimension].isDivisible() && 
+            (!mRanges[longest].isDivisible() || mRanges[dimension].size() > mRanges[longest].size()))
+        {
+            longest = dimension;
+        }
+    }
+
+    auto upper = mRanges;
+    upper[longest] = mRanges[longest].split();
+    return BlockedTile(upper);
+}
+
+//------------------------------------------------------------------------------
+template<size_t DIMS>
+uint64_t mortonCode(const std::array<size_t, DIMS>& coordinates)
+{
+    uint64_t code = 0;
+    for(size_t bit = 0; bit * DIMS < 64; ++bit)
+    {
+        for(size_t dimension = 0; dimension < DIMS && bit * DIMS + dimension < 64; ++dimension)
+        {
+            code |= static_cast<uint64_t>((coordinates[dimension] >> bit) & 1) << (bit * DIMS + dimension);
+        }
+    }
+    return code;
+}
+
+}
+}
+}
\ No newline at end of file
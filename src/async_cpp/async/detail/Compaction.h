@@ -0,0 +1,236 @@
+#pragma once
+#include "async_cpp/async/detail/PhasedTask.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Run the phases of a stream compaction as part of a phased task, moving data marked to be kept into a new set in its 
+ * original order. Kept items are counted per block in parallel, then moved by scatterKept.
+ * @param task Phased task to run the compaction phases on
+ * @param data Data to compact, kept items are moved from
+ * @param keep Flag for each item of data, non-zero if item should be kept
+ * @param grainSize Number of items in each block
+ * @param next Step run with the compacted data once complete
+ */
+template<class TDATA, class TRESULT>
+inline void compact(std::shared_ptr<PhasedTask<TRESULT>> task,
+    std::shared_ptr<std::vector<TDATA>> data,
+    std::shared_ptr<std::vector<uint8_t>> keep,
+    const size_t grainSize,
+    std::function<void(std::shared_ptr<std::vector<TDATA>>)> next);
+
+/**
+ * Run the final phase of a stream compaction once kept items have been counted per block. When data can be 
+ * preallocated and written by index, counts are scanned into output offsets, and each block moves its kept items to its 
+ * offset in a preallocated output in parallel. Otherwise, such as for data without a default value or packed bools, 
+ * each block gathers its kept items in parallel, and blocks are then moved into a reserved output in order.
+ * @param task Phased task to run the compaction phase on
+ * @param data Data to compact, kept items are moved from
+ * @param keep Flag for each item of data, non-zero if item should be kept
+ * @param counts Number of kept items in each block, may be replaced with the offset of each block in the output
+ * @param grainSize Number of items in each block
+ * @param next Step run with the compacted data once complete
+ */
+template<class TDATA, class TRESULT>
+inline void scatterKept(std::shared_ptr<PhasedTask<TRESULT>> task,
+    std::shared_ptr<std::vector<TDATA>> data,
+    std::shared_ptr<std::vector<uint8_t>> keep,
+    std::shared_ptr<std::vector<size_t>> counts,
+    const size_t grainSize,
+    std::function<void(std::shared_ptr<std::vector<TDATA>>)> next);
+template<class TDATA, class TRESULT>
+inline void scatterKept(std::shared_ptr<PhasedTask<TRESULT>> task,
+    std::shared_ptr<std::vector<TDATA>> data,
+    std::shared_ptr<std::vector<uint8_t>> keep,
+    std::shared_ptr<std::vector<size_t>> counts,
+    const size_t grainSize,
+    std::function<void(std::shared_ptr<std::vector<TDATA>>)> next,
+    std::true_type isIndexable);
+template<class TDATA, class TRESULT>
+inline void scatterKept(std::shared_ptr<PhasedTask<TRESULT>> task,
+    std::shared_ptr<std::vector<TDATA>> data,
+    std::shared_ptr<std::vector<uint8_t>> keep,
+    std::shared_ptr<std::vector<size_t>> counts,
+    const size_t grainSize,
+    std::function<void(std::shared_ptr<std::vector<TDATA>>)> next,
+    std::false_type isIndexable);
+
+/**
+ * Move the kept items of one block to its position in the output. Trivially copyable items are copied whether kept or 
+ * not, with the position only advanced for kept items, so there is no branch per item. Copying stops once all kept 
+ * items are written, so no block writes past its own part of the output.
+ * @param data First item of block
+ * @param keep First flag of block
+ * @param size Number of items in block
+ * @param output First position of block in output
+ * @param count Number of kept items in block
+ */
+template<class TDATA>
+inline void moveKeptBlock(TDATA* data, const uint8_t* keep, const size_t size, TDATA* output, const size_t count, 
+    std::true_type isTriviallyCopyable);
+template<class TDATA>
+inline void moveKeptBlock(TDATA* data, const uint8_t* keep, const size_t size, TDATA* output, const size_t count, 
+    std::false_type isTriviallyCopyable);
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+void compact(std::shared_ptr<PhasedTask<TRESULT>> task,
+    std::shared_ptr<std::vector<TDATA>> data,
+    std::shared_ptr<std::vector<uint8_t>> keep,
+    const size_t grainSize,
+    std::function<void(std::shared_ptr<std::vector<TDATA>>)> next)
+{
+    auto nbBlocks = (data->size() + grainSize - 1) / grainSize;
+    auto counts = std::make_shared<std::vector<size_t>>(nbBlocks, 0);
+    auto countKept = [data, keep, counts, grainSize](const size_t begin, const size_t end)->void
+    {
+        for(size_t block = begin; block < end; ++block)
+        {
+            size_t count = 0;
+            auto last = std::min(data->size(), (block + 1) * grainSize);
+            for(size_t i = block * grainSize; i < last; ++i)
+            {
+                if((*keep)[i]) ++count;
+            }
+            (*counts)[block] = count;
+        }
+    };
+
+    task->runPhase(nbBlocks, 1, countKept, [task, data, keep, counts, grainSize, next]()->void
+    {
+        scatterKept(task, data, keep, counts, grainSize, next);
+    } );
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+void scatterKept(std::shared_ptr<PhasedTask<TRESULT>> task,
+    std::shared_ptr<std::vector<TDATA>> data,
+    std::shared_ptr<std::vector<uint8_t>> keep,
+    std::shared_ptr<std::vector<size_t>> counts,
+    const size_t grainSize,
+    std::function<void(std::shared_ptr<std::vector<TDATA>>)> next)
+{
+    //bools are packed, so blocks writing neighbouring bools by index would race
+    scatterKept(task, data, keep, counts, grainSize, next, std::integral_constant<bool, 
+        std::is_default_constructible<TDATA>::value && !std::is_same<TDATA, bool>::value>());
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+void scatterKept(std::shared_ptr<PhasedTask<TRESULT>> task,
+    std::shared_ptr<std::vector<TDATA>> data,
+    std::shared_ptr<std::vector<uint8_t>> keep,
+    std::shared_ptr<std::vector<size_t>> counts,
+    const size_t grainSize,
+    std::function<void(std::shared_ptr<std::vector<TDATA>>)> next,
+    std::true_type)
+{
+    size_t total = 0;
+    for(auto& count : *counts)
+    {
+        auto offset = total;
+        total += count;
+        count = offset;
+    }
+
+    auto output = std::make_shared<std::vector<TDATA>>(total);
+    auto moveKept = [data, keep, counts, output, grainSize, total](const size_t begin, const size_t end)->void
+    {
+        for(size_t block = begin; block < end; ++block)
+        {
+            auto position = (*counts)[block];
+            auto next = (block + 1 < counts->size()) ? (*counts)[block + 1] : total;
+            auto first = block * grainSize;
+            auto last = std::min(data->size(), first + grainSize);
+            moveKeptBlock(data->data() + first, keep->data() + first, last - first, output->data() + position, 
+                next - position, std::is_trivially_copyable<TDATA>());
+        }
+    };
+
+    task->runPhase(counts->size(), 1, moveKept, [output, next]()->void
+    {
+        next(output);
+    } );
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA, class TRESULT>
+void scatterKept(std::shared_ptr<PhasedTask<TRESULT>> task,
+    std::shared_ptr<std::vector<TDATA>> data,
+    std::shared_ptr<std::vector<uint8_t>> keep,
+    std::shared_ptr<std::vector<size_t>> counts,
+    const size_t grainSize,
+    std::function<void(std::shared_ptr<std::vector<TDATA>>)> next,
+    std::false_type)
+{
+    auto blocks = std::make_shared<std::vector<std::vector<TDATA>>>(counts->size());
+    auto gatherKept = [data, keep, counts, blocks, grainSize](const size_t begin, const size_t end)->void
+    {
+        for(size_t block = begin; block < end; ++block)
+        {
+            auto& kept = (*blocks)[block];
+            kept.reserve((*counts)[block]);
+            auto last = std::min(data->size(), (block + 1) * grainSize);
+            for(size_t i = block * grainSize; i < last; ++i)
+            {
+                if((*keep)[i]) kept.push_back(std::move((*data)[i]));
+            }
+        }
+    };
+
+    task->runPhase(counts->size(), 1, gatherKept, [counts, blocks, next]()->void
+    {
+        size_t total = 0;
+        for(auto count : *counts)
+        {
+            total += count;
+        }
+
+        auto output = std::make_shared<std::vector<TDATA>>();
+        output->reserve(total);
+        for(auto& kept : *blocks)
+        {
+            std::move(kept.begin(), kept.end(), std::back_inserter(*output));
+            std::vector<TDATA>().swap(kept);
+        }
+        next(output);
+    } );
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+void moveKeptBlock(TDATA* data, const uint8_t* keep, const size_t size, TDATA* output, const size_t count, 
+    std::true_type)
+{
+    size_t position = 0;
+    for(size_t i = 0; i < size && position < count; ++i)
+    {
+        output[position] = data[i];
+        position += (0 != keep[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+template<class TDATA>
+void moveKeptBlock(TDATA* data, const uint8_t* keep, const size_t size, TDATA* output, const size_t count, 
+    std::false_type)
+{
+    size_t position = 0;
+    for(size_t i = 0; i < size && position < count; ++i)
+    {
+        if(keep[i]) output[position++] = std::move(data[i]);
+    }
+}
+
+}
+}
+}
\ No newline at end of file
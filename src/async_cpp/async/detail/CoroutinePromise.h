@@ -0,0 +1,241 @@
+#pragma once
+#include "async_cpp/async/detail/FramePool.h"
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <optional>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Common promise behavior for coroutines. Frames are allocated from a pool, coroutines are lazily started, and on 
+ * completion either resume the coroutine awaiting them or, if detached, notify completion and destroy themselves.
+ */
+//------------------------------------------------------------------------------
+class CoroutinePromiseBase {
+public:
+    /**
+     * Awaitable used when the coroutine completes.
+     */
+    class FinalAwaiter {
+    public:
+        inline bool await_ready() const noexcept;
+        template<class TPROMISE>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<TPROMISE> handle) noexcept;
+        inline void await_resume() const noexcept;
+    };
+
+    inline CoroutinePromiseBase();
+
+    static inline void* operator new(const size_t size);
+    static inline void operator delete(void* frame, const size_t size);
+
+    inline std::suspend_always initial_suspend() const noexcept;
+    inline FinalAwaiter final_suspend() const noexcept;
+    inline void unhandled_exception();
+
+    /**
+     * Set the coroutine to resume once this coroutine completes.
+     * @param continuation Awaiting coroutine
+     */
+    inline void setContinuation(std::coroutine_handle<> continuation);
+
+    /**
+     * Detach this coroutine, destroying it once complete after invoking a function.
+     * @param onComplete Function to invoke when complete
+     */
+    inline void detach(std::function<void(void)> onComplete);
+
+    /**
+     * Complete this coroutine without running it, invoking the detached completion function.
+     * @param ex Exception to complete with
+     */
+    inline void fail(std::exception_ptr ex);
+
+    /**
+     * Retrieve the exception that ended this coroutine.
+     * @return Exception, null if none
+     */
+    inline std::exception_ptr exception() const;
+
+private:
+    std::coroutine_handle<> mContinuation;
+    std::function<void(void)> mOnComplete;
+    std::exception_ptr mException;
+};
+
+/**
+ * Promise for coroutines returning a value.
+ */
+//------------------------------------------------------------------------------
+template<class TRESULT>
+class CoroutinePromise : public CoroutinePromiseBase {
+public:
+    std::coroutine_handle<CoroutinePromise> get_return_object();
+    void return_value(TRESULT value);
+
+    /**
+     * Retrieve the value returned by this coroutine.
+     * @return Pointer to value, null if coroutine did not return a value
+     */
+    TRESULT* value();
+
+private:
+    std::optional<TRESULT> mValue;
+};
+
+/**
+ * Promise for coroutines returning nothing.
+ */
+//------------------------------------------------------------------------------
+template<>
+class CoroutinePromise<void> : public CoroutinePromiseBase {
+public:
+    inline std::coroutine_handle<CoroutinePromise> get_return_object();
+    inline void return_void();
+    inline void* value();
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+bool CoroutinePromiseBase::FinalAwaiter::await_ready() const noexcept
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------
+template<class TPROMISE>
+std::coroutine_handle<> CoroutinePromiseBase::FinalAwaiter::await_suspend(std::coroutine_handle<TPROMISE> handle) noexcept
+{
+    CoroutinePromiseBase& promise = handle.promise();
+    if(promise.mContinuation)
+    {
+        return promise.mContinuation;
+    }
+
+    if(promise.mOnComplete)
+    {
+        promise.mOnComplete();
+    }
+    handle.destroy();
+    return std::noop_coroutine();
+}
+
+//------------------------------------------------------------------------------
+void CoroutinePromiseBase::FinalAwaiter::await_resume() const noexcept
+{
+
+}
+
+//------------------------------------------------------------------------------
+CoroutinePromiseBase::CoroutinePromiseBase()
+{
+
+}
+
+//------------------------------------------------------------------------------
+void* CoroutinePromiseBase::operator new(const size_t size)
+{
+    return FramePool::allocate(size);
+}
+
+//------------------------------------------------------------------------------
+void CoroutinePromiseBase::operator delete(void* frame, const size_t size)
+{
+    FramePool::deallocate(frame, size);
+}
+
+//------------------------------------------------------------------------------
+std::suspend_always CoroutinePromiseBase::initial_suspend() const noexcept
+{
+    return std::suspend_always();
+}
+
+//------------------------------------------------------------------------------
+CoroutinePromiseBase::FinalAwaiter CoroutinePromiseBase::final_suspend() const noexcept
+{
+    return FinalAwaiter();
+}
+
+//------------------------------------------------------------------------------
+void CoroutinePromiseBase::unhandled_exception()
+{
+    mException = std::current_exception();
+}
+
+//------------------------------------------------------------------------------
+void CoroutinePromiseBase::setContinuation(std::coroutine_handle<> continuation)
+{
+    mContinuation = continuation;
+}
+
+//------------------------------------------------------------------------------
+void CoroutinePromiseBase::detach(std::function<void(void)> onComplete)
+{
+    mOnComplete = onComplete;
+}
+
+//------------------------------------------------------------------------------
+void CoroutinePromiseBase::fail(std::exception_ptr ex)
+{
+    mException = ex;
+    if(mOnComplete)
+    {
+        mOnComplete();
+    }
+}
+
+//------------------------------------------------------------------------------
+std::exception_ptr CoroutinePromiseBase::exception() const
+{
+    return mException;
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+std::coroutine_handle<CoroutinePromise<TRESULT>> CoroutinePromise<TRESULT>::get_return_object()
+{
+    return std::coroutine_handle<CoroutinePromise>::from_promise(*this);
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+void CoroutinePromise<TRESULT>::return_value(TRESULT value)
+{
+    mValue.emplace(std::move(value));
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+TRESULT* CoroutinePromise<TRESULT>::value()
+{
+    return mValue ? &(*mValue) : nullptr;
+}
+
+//------------------------------------------------------------------------------
+std::coroutine_handle<CoroutinePromise<void>> CoroutinePromise<void>::get_return_object()
+{
+    return std::coroutine_handle<CoroutinePromise>::from_promise(*this);
+}
+
+//------------------------------------------------------------------------------
+void CoroutinePromise<void>::return_void()
+{
+
+}
+
+//------------------------------------------------------------------------------
+void* CoroutinePromise<void>::value()
+{
+    return nullptr;
+}
+
+}
+}
+}
+
+#endif
\ No newline at end of file
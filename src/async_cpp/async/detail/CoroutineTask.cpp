@@ -0,0 +1,9 @@
+#include "async_cpp/async/detail/CoroutineTask.h"
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+}
+}
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "async_cpp/async/detail/CoroutinePromise.h"
+
+#include "async_cpp/tasks/Task.h"
+
+#if defined(__cpp_impl_coroutine)
+#include <stdexcept>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Task which starts a detached coroutine. If cancelled, the coroutine is failed and destroyed without running.
+ */
+//------------------------------------------------------------------------------
+template<class TPROMISE>
+class CoroutineTask : public tasks::Task {
+public:
+    CoroutineTask(std::coroutine_handle<TPROMISE> handle);
+    virtual ~CoroutineTask();
+
+protected:
+    virtual void performSpecific() final;
+    virtual void notifyCancel() final;
+
+private:
+    std::coroutine_handle<TPROMISE> mHandle;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TPROMISE>
+CoroutineTask<TPROMISE>::CoroutineTask(std::coroutine_handle<TPROMISE> handle)
+    : Task(), mHandle(handle)
+{
+    if(!mHandle) { throw(std::invalid_argument("CoroutineTask: No coroutine")); }
+}
+
+//------------------------------------------------------------------------------
+template<class TPROMISE>
+CoroutineTask<TPROMISE>::~CoroutineTask()
+{
+
+}
+
+//------------------------------------------------------------------------------
+template<class TPROMISE>
+void CoroutineTask<TPROMISE>::performSpecific()
+{
+    mHandle.resume();
+}
+
+//------------------------------------------------------------------------------
+template<class TPROMISE>
+void CoroutineTask<TPROMISE>::notifyCancel()
+{
+    mHandle.promise().fail(std::make_exception_ptr(std::runtime_error("Cancelled")));
+    mHandle.destroy();
+}
+
+}
+}
+}
+
+#endif
\ No newline at end of file
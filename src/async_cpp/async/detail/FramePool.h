@@ -0,0 +1,118 @@
+#pragma once
+#include "async_cpp/async/Async.h"
+
+#include <cstddef>
+#include <new>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Thread local pool of coroutine frames, bucketed by size. Frames released on a thread are reused by frames later 
+ * allocated on that thread, avoiding a heap allocation per coroutine call. Large frames go directly to the heap.
+ */
+//------------------------------------------------------------------------------
+class FramePool {
+public:
+    /**
+     * Allocate memory for a coroutine frame.
+     * @param size Size of frame in bytes
+     * @return Memory for frame
+     */
+    static inline void* allocate(const size_t size);
+
+    /**
+     * Release memory for a coroutine frame, retaining it for reuse if possible.
+     * @param frame Frame previously returned by allocate
+     * @param size Size of frame in bytes, as passed to allocate
+     */
+    static inline void deallocate(void* frame, const size_t size);
+
+private:
+    static const size_t BUCKET_BYTES = 64;
+    static const size_t NB_BUCKETS = 16;
+    static const size_t MAX_CACHED_FRAMES = 64;
+
+    struct Block {
+        Block* next;
+    };
+
+    struct Buckets {
+        inline ~Buckets();
+
+        Block* heads[NB_BUCKETS];
+        size_t counts[NB_BUCKETS];
+    };
+
+    static inline Buckets& buckets();
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+FramePool::Buckets::~Buckets()
+{
+    for(size_t i = 0; i < NB_BUCKETS; ++i)
+    {
+        while(heads[i])
+        {
+            auto next = heads[i]->next;
+            ::operator delete(heads[i]);
+            heads[i] = next;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+FramePool::Buckets& FramePool::buckets()
+{
+    thread_local Buckets threadBuckets = Buckets();
+    return threadBuckets;
+}
+
+//------------------------------------------------------------------------------
+void* FramePool::allocate(const size_t size)
+{
+    auto bucket = (size + BUCKET_BYTES - 1) / BUCKET_BYTES;
+    if(0 == bucket || bucket > NB_BUCKETS)
+    {
+        return ::operator new(size);
+    }
+
+    auto& pool = buckets();
+    auto block = pool.heads[bucket - 1];
+    if(block)
+    {
+        pool.heads[bucket - 1] = block->next;
+        --pool.counts[bucket - 1];
+        return block;
+    }
+    //always allocate the full bucket, so frame can be reused by any size in this bucket
+    return ::operator new(bucket * BUCKET_BYTES);
+}
+
+//------------------------------------------------------------------------------
+void FramePool::deallocate(void* frame, const size_t size)
+{
+    auto bucket = (size + BUCKET_BYTES - 1) / BUCKET_BYTES;
+    if(0 == bucket || bucket > NB_BUCKETS)
+    {
+        ::operator delete(frame);
+        return;
+    }
+
+    auto& pool = buckets();
+    if(pool.counts[bucket - 1] >= MAX_CACHED_FRAMES)
+    {
+        ::operator delete(frame);
+        return;
+    }
+    auto block = static_cast<Block*>(frame);
+    block->next = pool.heads[bucket - 1];
+    pool.heads[bucket - 1] = block;
+    ++pool.counts[bucket - 1];
+}
+
+}
+}
+}
\ No newline at end of file
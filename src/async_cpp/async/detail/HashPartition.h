@@ -0,0 +1,49 @@
+#pragma once
+#include "async_cpp/async/Async.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Choose how many partitions to split blocks of hashed data into, enough to keep every hardware thread busy without 
+ * creating more partitions than blocks.
+ * @param nbBlocks Number of blocks of data
+ * @return Number of partitions, at least one
+ */
+inline size_t partitionCount(const size_t nbBlocks);
+
+/**
+ * Find the partition of a hash. The hash is mixed first so partitions don't share low bits with the buckets of hash 
+ * tables built from each partition.
+ * @param hash Hash of an item
+ * @param nbPartitions Number of partitions
+ * @return Index of partition
+ */
+inline size_t partitionOf(const size_t hash, const size_t nbPartitions);
+
+//inline implementations
+//------------------------------------------------------------------------------
+size_t partitionCount(const size_t nbBlocks)
+{
+    return std::max<size_t>(1, std::min<size_t>(nbBlocks, 4 * std::max(1u, std::thread::hardware_concurrency())));
+}
+
+//------------------------------------------------------------------------------
+size_t partitionOf(const size_t hash, const size_t nbPartitions)
+{
+    uint64_t mixed = hash;
+    mixed ^= mixed >> 33;
+    mixed *= 0xff51afd7ed558ccdULL;
+    mixed ^= mixed >> 33;
+    return static_cast<size_t>(mixed % nbPartitions);
+}
+
+}
+}
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+#include "async_cpp/async/Async.h"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Find where the first outputs of a stable merge of two sorted ranges come from, by binary search along the merge path. 
+ * Equivalent items are taken from the first range before the second, as std::merge does. Splitting the output of a 
+ * merge into chunks this way allows each chunk to be merged independently.
+ * @param outputIndex Number of outputs, from the start of the merge
+ * @param first Start of first sorted range
+ * @param firstSize Number of items in first range
+ * @param second Start of second sorted range
+ * @param secondSize Number of items in second range
+ * @param compare Strict weak ordering the ranges are sorted by
+ * @return Number of the outputs taken from the first range, the rest are taken from the second
+ */
+template<class TITERATOR, class TCOMPARE>
+inline size_t mergePathSplit(const size_t outputIndex,
+    TITERATOR first, 
+    const size_t firstSize, 
+    TITERATOR second, 
+    const size_t secondSize, 
+    TCOMPARE& compare);
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TITERATOR, class TCOMPARE>
+size_t mergePathSplit(const size_t outputIndex,
+    TITERATOR first, 
+    const size_t firstSize, 
+    TITERATOR second, 
+    const size_t secondSize, 
+    TCOMPARE& compare)
+{
+    size_t low = outputIndex > secondSize ? outputIndex - secondSize : 0;
+    size_t high = std::min(outputIndex, firstSize);
+    while(low < high)
+    {
+        auto middle = low + (high - low) / 2;
+        //an item from the first range precedes any item of the second it is not greater than
+        if(!compare(second[outputIndex - middle - 1], first[middle]))
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+}
+}
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "async_cpp/async/detail/IParallelTask.h"
 #include "async_cpp/async/detail/ReadyVisitor.h"
+#include "async_cpp/async/detail/ResultState.h"
 #include "async_cpp/async/detail/ValueVisitor.h"
 #include "async_cpp/tasks/IManager.h"
 
@@ -27,6 +28,7 @@ public:
     typedef typename std::function < void(std::exception_ptr, result_set_t&& ) > then_t;
     /**
      * Create an asynchronous task that does not take in information and returns an AsyncResult via a packaged_task.
+     * @param tasksOutstanding Total weight of results to collect before invoking then function
      * @param generateResult packaged_task that will produce the AsyncResult
      */
     ParallelCollectTask(std::weak_ptr<tasks::IManager> mgr,
@@ -36,7 +38,18 @@ public:
     virtual ~ParallelCollectTask();
 
     AsyncResult result();
-    void notifyCompletion(const size_t taskOrder, typename VariantType&& result);
+    /**
+     * Check if results are still being collected. Collection stops when cancelled or a task fails.
+     * @return True if results are still wanted
+     */
+    inline bool isValid() const;
+    /**
+     * Store the result of a task.
+     * @param taskOrder Position of result within the result set
+     * @param result Result of task
+     * @param weight Amount result counts towards the total outstanding, such as the number of iterations in a chunk
+     */
+    void notifyCompletion(const size_t taskOrder, typename VariantType&& result, const size_t weight = 1);
     virtual void notifyException(std::exception_ptr ex) final;
 
 protected:
@@ -47,8 +60,10 @@ private:
     std::mutex mResultsMutex;
     std::map<size_t, typename VariantType> mResults;
     size_t mResultsRequired;
+    size_t mResultsReceived;
     result_set_t mPreparedResults;
-    std::packaged_task<bool(std::exception_ptr, result_set_t&&)> mTask;
+    std::function<void(std::exception_ptr, result_set_t&&)> mTask;
+    std::shared_ptr<ResultState> mState;
     std::atomic_bool mValid;
 };
 
@@ -59,12 +74,17 @@ ParallelCollectTask<TRESULT>::ParallelCollectTask(std::weak_ptr<tasks::IManager>
         const size_t tasksOutstanding,
         typename then_t thenFunction)
     : IParallelTask(mgr),
-      mResultsRequired(tasksOutstanding)
+      mResultsRequired(tasksOutstanding),
+      mResultsReceived(0),
+      mState(std::make_shared<ResultState>())
 {
     mValid.store(true);
-    mPreparedResults.reserve(mResultsRequired);
-    mTask = std::packaged_task<bool(std::exception_ptr, result_set_t&&)>([thenFunction](std::exception_ptr ex, result_set_t&& results)->bool
+    auto state = mState;
+    mTask = [thenFunction, state](std::exception_ptr ex, result_set_t&& results)->void
     {
+        //cancellation and failures may race with completion, only finish once
+        if(!state->claim()) return;
+
         try
         {
             thenFunction(ex, std::move(results));
@@ -74,11 +94,8 @@ ParallelCollectTask<TRESULT>::ParallelCollectTask(std::weak_ptr<tasks::IManager>
             ex = std::current_exception();
         }
 
-
-        if(ex) std::rethrow_exception(ex);
-
-        return true;
-    } );
+        state->complete(ex);
+    };
 }
 
 //------------------------------------------------------------------------------
@@ -86,9 +103,11 @@ template<class TRESULT>
 ParallelCollectTask<TRESULT>::ParallelCollectTask(ParallelCollectTask&& other)
     : IParallelTask(std::move(other)),
       mResultsRequired(std::move(other.mResultsRequired)),
+      mResultsReceived(std::move(other.mResultsReceived)),
       mResults(std::move(other.mResults)),
       mPreparedResults(std::move(other.mPreparedResults)),
-      mTask(std::move(other.mTask))
+      mTask(std::move(other.mTask)),
+      mState(std::move(other.mState))
 {
     mValid.store(other.mValid);
 }
@@ -97,7 +116,12 @@ ParallelCollectTask<TRESULT>::ParallelCollectTask(ParallelCollectTask&& other)
 template<class TRESULT>
 ParallelCollectTask<TRESULT>::~ParallelCollectTask()
 {
-
+    //dropped without finishing, such as when an operation never reports its result or the task is never run, so 
+    //consumers are not left waiting. A task moved into a re-queued task has passed its state on
+    if(mState && mState->claim())
+    {
+        mState->complete(std::make_exception_ptr(std::runtime_error("Abandoned")));
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -109,6 +133,8 @@ void ParallelCollectTask<TRESULT>::performSpecific()
         ReadyVisitor<TRESULT> isReady;
         ValueVisitor<TRESULT> getValue;
         std::map<size_t, typename VariantType> readyResults;
+        //weighted results may be far fewer than the total required, so size by what was actually collected
+        mPreparedResults.reserve(mPreparedResults.size() + mResults.size());
         for(auto& kv : mResults)
         {
             if(boost::apply_visitor(isReady, kv.second))
@@ -143,12 +169,19 @@ void ParallelCollectTask<TRESULT>::performSpecific()
 template<class TRESULT>
 AsyncResult ParallelCollectTask<TRESULT>::result()
 {
-    return AsyncResult(mTask.get_future());
+    return AsyncResult(mState, shared_from_this());
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+bool ParallelCollectTask<TRESULT>::isValid() const
+{
+    return mValid;
 }
 
 //------------------------------------------------------------------------------
 template<class TRESULT>
-void ParallelCollectTask<TRESULT>::notifyCompletion(const size_t taskIndex, typename VariantType&& result)
+void ParallelCollectTask<TRESULT>::notifyCompletion(const size_t taskIndex, typename VariantType&& result, const size_t weight)
 {
     //only care about results if we're still valid
     if(mValid)
@@ -158,7 +191,8 @@ void ParallelCollectTask<TRESULT>::notifyCompletion(const size_t taskIndex, type
         if(mResults.find(taskIndex) == mResults.end())
         {
             mResults.emplace(taskIndex, std::move(result));
-            if(mResults.size() == mResultsRequired)
+            mResultsReceived += weight;
+            if(mResultsReceived == mResultsRequired)
             {
                 mManager.lock()->run(shared_from_this());
             }
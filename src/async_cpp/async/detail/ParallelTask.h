@@ -53,7 +53,11 @@ ParallelTask<TRESULT>::~ParallelTask()
 template<class TRESULT>
 void ParallelTask<TRESULT>::performSpecific()
 {
-    mGenerateResultFunc();
+    //results are no longer wanted if collection was cancelled or failed
+    if(mCollectTask->isValid())
+    {
+        mGenerateResultFunc();
+    }
 }
 
 //------------------------------------------------------------------------------
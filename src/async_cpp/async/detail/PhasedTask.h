@@ -0,0 +1,228 @@
+#pragma once
+#include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/detail/RangeTask.h"
+#include "async_cpp/async/detail/ResultState.h"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Task which runs an algorithm as a sequence of parallel phases over chunks of indices, such as the passes of a scan or 
+ * sort, and then passes the algorithm's result to a then function. Cancelling this task cancels the running phase.
+ */
+//------------------------------------------------------------------------------
+template<class TRESULT>
+class PhasedTask : public IParallelTask<TRESULT> {
+public:
+    typedef typename std::function<void(std::exception_ptr, TRESULT*)> then_t;
+    typedef std::function<void(const size_t, const size_t)> phase_op_t;
+
+    /**
+     * Create a task that will invoke a then function once its phases finish.
+     * @param thenFunction Function invoked with the result of the final phase, or an exception if any phase failed
+     */
+    PhasedTask(std::weak_ptr<tasks::IManager> mgr, typename then_t thenFunction);
+    virtual ~PhasedTask();
+
+    AsyncResult result();
+
+    /**
+     * Check if phases are still wanted. Phases stop when cancelled or one fails.
+     * @return True if phases are still wanted
+     */
+    inline bool isValid() const;
+
+    /**
+     * Run an operation over chunks of indices [0, nbIndices) in parallel, invoking the next step once all chunks are 
+     * complete. Any exception from the operation or next step fails this task.
+     * @param nbIndices Number of indices to run the operation over
+     * @param grainSize Largest number of indices passed to a single operation
+     * @param op Operation run for each chunk of indices [begin, end)
+     * @param next Step run once the phase is complete, typically starting another phase or finishing
+     */
+    void runPhase(const size_t nbIndices, const size_t grainSize, phase_op_t op, std::function<void(void)> next);
+
+    /**
+     * Finish successfully, invoking the then function with a result.
+     * @param result Result of the algorithm
+     */
+    void finish(TRESULT* result);
+    virtual void notifyException(std::exception_ptr ex) final;
+
+protected:
+    virtual void performSpecific() final;
+    virtual void notifyCancel() final;
+
+private:
+    void runNext(std::function<void(void)>& next);
+
+    std::function<void(std::exception_ptr, TRESULT*)> mTask;
+    std::shared_ptr<ResultState> mState;
+    std::atomic_bool mValid;
+    std::mutex mPhaseMutex;
+    std::weak_ptr<tasks::Task> mPhase;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TRESULT>
+PhasedTask<TRESULT>::PhasedTask(std::weak_ptr<tasks::IManager> mgr, typename then_t thenFunction)
+    : IParallelTask(mgr),
+      mState(std::make_shared<ResultState>())
+{
+    mValid.store(true);
+    auto state = mState;
+    mTask = [thenFunction, state](std::exception_ptr ex, TRESULT* result)->void
+    {
+        //cancellation and failures may race with completion, only finish once
+        if(!state->claim()) return;
+
+        try
+        {
+            if(thenFunction) thenFunction(ex, result);
+        }
+        catch(...)
+        {
+            ex = std::current_exception();
+        }
+
+        state->complete(ex);
+    };
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+PhasedTask<TRESULT>::~PhasedTask()
+{
+    //dropped without finishing, such as when an operation never reports its result or the task is never run, so 
+    //consumers are not left waiting
+    if(mState->claim())
+    {
+        mState->complete(std::make_exception_ptr(std::runtime_error("Abandoned")));
+    }
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+AsyncResult PhasedTask<TRESULT>::result()
+{
+    return AsyncResult(mState, shared_from_this());
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+bool PhasedTask<TRESULT>::isValid() const
+{
+    return mValid;
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+void PhasedTask<TRESULT>::runPhase(const size_t nbIndices, 
+    const size_t grainSize, 
+    phase_op_t op, 
+    std::function<void(void)> next)
+{
+    if(!mValid) return;
+    if(0 == nbIndices)
+    {
+        runNext(next);
+        return;
+    }
+
+    auto self = std::static_pointer_cast<PhasedTask>(shared_from_this());
+    auto collectTask = std::make_shared<ParallelCollectTask<bool>>(mManager, nbIndices, 
+        [self, next](std::exception_ptr ex, std::vector<bool>&&) mutable->void
+        {
+            if(ex)
+            {
+                self->notifyException(ex);
+            }
+            else
+            {
+                self->runNext(next);
+            }
+        } );
+    auto rangeOp = [op](const size_t begin, const size_t end, RangeTask<bool>::callback_t cb)->void
+    {
+        op(begin, end);
+        cb(AsyncResult());
+    };
+    auto task = std::make_shared<RangeTask<bool>>(mManager, rangeOp, BlockedRange(0, nbIndices, grainSize), collectTask);
+
+    {
+        std::lock_guard<std::mutex> lock(mPhaseMutex);
+        mPhase = collectTask;
+    }
+    //cancellation may have happened before the phase was visible to it
+    if(!mValid)
+    {
+        collectTask->cancel();
+        return;
+    }
+    mManager.lock()->run(task);
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+void PhasedTask<TRESULT>::runNext(std::function<void(void)>& next)
+{
+    if(!mValid) return;
+    try
+    {
+        next();
+    }
+    catch(...)
+    {
+        notifyException(std::current_exception());
+    }
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+void PhasedTask<TRESULT>::finish(TRESULT* result)
+{
+    if(mValid)
+    {
+        mTask(nullptr, result);
+    }
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+void PhasedTask<TRESULT>::performSpecific()
+{
+    //phases are run through runPhase, there is no work of our own
+}
+
+//------------------------------------------------------------------------------
+template<class T>
+void PhasedTask<T>::notifyCancel()
+{
+    mValid.exchange(false);
+    mTask(std::make_exception_ptr(std::runtime_error("Cancelled")), nullptr);
+
+    std::shared_ptr<tasks::Task> phase;
+    {
+        std::lock_guard<std::mutex> lock(mPhaseMutex);
+        phase = mPhase.lock();
+    }
+    if(phase) phase->cancel();
+}
+
+//------------------------------------------------------------------------------
+template<class T>
+void PhasedTask<T>::notifyException(std::exception_ptr ex)
+{
+    mValid.exchange(false);
+    mTask(ex, nullptr);
+}
+
+}
+}
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+#include "async_cpp/async/Async.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Maps arithmetic values to unsigned keys of the same size, such that ordering keys as unsigned integers orders the 
+ * values ascending. Used by radix sorting.
+ */
+//------------------------------------------------------------------------------
+template<class T>
+struct RadixKey {
+    static_assert(std::is_arithmetic<T>::value, "RadixKey: Only arithmetic types have radix keys");
+
+    typedef typename std::conditional<sizeof(T) == 1, uint8_t,
+        typename std::conditional<sizeof(T) == 2, uint16_t,
+        typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type>::type>::type key_t;
+
+    /**
+     * Create the key for a value.
+     * @param value Value to create key for
+     * @return Key which orders the same as value
+     */
+    static inline key_t toKey(const T& value);
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class T>
+typename RadixKey<T>::key_t RadixKey<T>::toKey(const T& value)
+{
+    static_assert(sizeof(T) == sizeof(key_t), "RadixKey: Unsupported value size");
+
+    key_t key;
+    std::memcpy(&key, &value, sizeof(key));
+    const key_t signBit = key_t(1) << (sizeof(key_t) * 8 - 1);
+    if(std::is_floating_point<T>::value)
+    {
+        //negative floats order in reverse of their bits
+        return (key & signBit) ? key_t(~key) : key_t(key | signBit);
+    }
+    else if(std::numeric_limits<T>::is_signed)
+    {
+        return key_t(key ^ signBit);
+    }
+    return key;
+}
+
+}
+}
+}
\ No newline at end of file
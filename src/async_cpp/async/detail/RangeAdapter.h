@@ -0,0 +1,101 @@
+#pragma once
+#include "async_cpp/async/detail/BlockedRange.h"
+#include "async_cpp/async/detail/BlockedTile.h"
+
+#include <array>
+#include <functional>
+#include <type_traits>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Adapts a range of indices to a range task, giving the operation run over the range, how it is invoked, and the index 
+ * its result is collected at.
+ */
+//------------------------------------------------------------------------------
+template<class TRANGE, class TCALLBACK>
+class RangeAdapter;
+
+/**
+ * Adapts a blocked range, whose operation is passed the indices [begin, end). Results are collected at the first index 
+ * of each range. Blocked ranges can be run in adaptively sized chunks.
+ */
+//------------------------------------------------------------------------------
+template<class TCALLBACK>
+class RangeAdapter<BlockedRange, TCALLBACK> {
+public:
+    typedef std::function<void(const size_t, const size_t, TCALLBACK)> operation_t;
+    typedef std::true_type is_adaptive_t;
+
+    size_t index(const BlockedRange& range) const;
+    void run(const operation_t& op, const BlockedRange& range, TCALLBACK callback) const;
+};
+
+/**
+ * Adapts a tile of a multi-dimensional set of indices, whose operation is passed the tile. Results are collected at the 
+ * row major index of the first item of each tile.
+ */
+//------------------------------------------------------------------------------
+template<size_t DIMS, class TCALLBACK>
+class RangeAdapter<BlockedTile<DIMS>, TCALLBACK> {
+public:
+    typedef std::function<void(const BlockedTile<DIMS>&, TCALLBACK)> operation_t;
+    typedef std::false_type is_adaptive_t;
+
+    /**
+     * Create an adapter for tiles of a set of indices.
+     * @param extents Size of each dimension of the whole set of indices
+     */
+    RangeAdapter(const std::array<size_t, DIMS>& extents);
+
+    size_t index(const BlockedTile<DIMS>& tile) const;
+    void run(const operation_t& op, const BlockedTile<DIMS>& tile, TCALLBACK callback) const;
+
+private:
+    std::array<size_t, DIMS> mExtents;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TCALLBACK>
+size_t RangeAdapter<BlockedRange, TCALLBACK>::index(const BlockedRange& range) const
+{
+    return range.begin();
+}
+
+//------------------------------------------------------------------------------
+template<class TCALLBACK>
+void RangeAdapter<BlockedRange, TCALLBACK>::run(const operation_t& op, const BlockedRange& range, TCALLBACK callback) const
+{
+    op(range.begin(), range.end(), callback);
+}
+
+//------------------------------------------------------------------------------
+template<size_t DIMS, class TCALLBACK>
+RangeAdapter<BlockedTile<DIMS>, TCALLBACK>::RangeAdapter(const std::array<size_t, DIMS>& extents)
+    : mExtents(extents)
+{
+
+}
+
+//------------------------------------------------------------------------------
+template<size_t DIMS, class TCALLBACK>
+size_t RangeAdapter<BlockedTile<DIMS>, TCALLBACK>::index(const BlockedTile<DIMS>& tile) const
+{
+    return tile.index(mExtents);
+}
+
+//------------------------------------------------------------------------------
+template<size_t DIMS, class TCALLBACK>
+void RangeAdapter<BlockedTile<DIMS>, TCALLBACK>::run(const operation_t& op, 
+    const BlockedTile<DIMS>& tile, 
+    TCALLBACK callback) const
+{
+    op(tile, callback);
+}
+
+}
+}
+}
@@ -0,0 +1,189 @@
+#pragma once
+#include "async_cpp/async/detail/AdaptivePartitioner.h"
+#include "async_cpp/async/detail/BlockedRange.h"
+#include "async_cpp/async/detail/ParallelCollectTask.h"
+#include "async_cpp/async/detail/RangeAdapter.h"
+
+#include <chrono>
+#include <functional>
+#include <type_traits>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Parallel task which runs an operation over a range of indices, either a blocked range or a tile of a multi-dimensional 
+ * set of indices, with the range adapter giving how the operation is run and the index its result is collected at. 
+ * Before running, the range is split in half until no larger than its grain size, with each upper half queued as 
+ * another range task so idle workers can take it. Given an adaptive partitioner, a blocked range is instead run in 
+ * timed chunks sized by the partitioner, splitting off an upper half between chunks only while the partitioner reports 
+ * idle workers.
+ */
+//------------------------------------------------------------------------------
+template<class TRESULT, class TRANGE = BlockedRange>
+class RangeTask : public IParallelTask<TRESULT> {
+public:
+    typedef typename std::function<void(typename VariantType&&)> callback_t;
+    typedef RangeAdapter<TRANGE, callback_t> adapter_t;
+    typedef typename adapter_t::operation_t operation_t;
+
+    RangeTask(std::weak_ptr<tasks::IManager> mgr, 
+        operation_t op,
+        TRANGE range,
+        std::shared_ptr<ParallelCollectTask<TRESULT>> collectTask,
+        std::shared_ptr<AdaptivePartitioner> partitioner = std::shared_ptr<AdaptivePartitioner>(),
+        adapter_t adapter = adapter_t());
+    virtual ~RangeTask();
+    virtual void notifyException(std::exception_ptr ex) final;
+
+protected:
+    virtual void performSpecific() final;
+    virtual void notifyCancel() final;
+
+private:
+    void performAdaptive(std::true_type isAdaptive);
+    void performAdaptive(std::false_type isAdaptive);
+    void releasePending();
+
+    operation_t mOp;
+    TRANGE mRange;
+    adapter_t mAdapter;
+    std::shared_ptr<ParallelCollectTask<TRESULT>> mCollectTask;
+    std::shared_ptr<AdaptivePartitioner> mPartitioner;
+    bool mIsPending;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TRESULT, class TRANGE>
+RangeTask<TRESULT, TRANGE>::RangeTask(std::weak_ptr<tasks::IManager> mgr, 
+        operation_t op,
+        TRANGE range,
+        std::shared_ptr<ParallelCollectTask<TRESULT>> collectTask,
+        std::shared_ptr<AdaptivePartitioner> partitioner,
+        adapter_t adapter)
+    : IParallelTask(mgr), mOp(op), mRange(range), mAdapter(adapter), mCollectTask(collectTask), 
+      mPartitioner(partitioner), mIsPending(false)
+{
+    if(!mCollectTask) { throw(std::invalid_argument("RangeTask: No collect task")); }
+    if(mPartitioner && !adapter_t::is_adaptive_t::value)
+    {
+        throw(std::invalid_argument("RangeTask: Range cannot be run adaptively"));
+    }
+    if(mPartitioner)
+    {
+        mPartitioner->queued();
+        mIsPending = true;
+    }
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT, class TRANGE>
+RangeTask<TRESULT, TRANGE>::~RangeTask()
+{
+    //task dropped without being performed or cancelled
+    releasePending();
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT, class TRANGE>
+void RangeTask<TRESULT, TRANGE>::performSpecific()
+{
+    if(mPartitioner)
+    {
+        performAdaptive(typename adapter_t::is_adaptive_t());
+        return;
+    }
+
+    //results are no longer wanted if collection was cancelled or failed
+    if(!mCollectTask->isValid()) return;
+
+    auto manager = mManager.lock();
+    if(manager)
+    {
+        while(mRange.isDivisible())
+        {
+            manager->run(std::make_shared<RangeTask>(mManager, mOp, mRange.split(), mCollectTask, 
+                std::shared_ptr<AdaptivePartitioner>(), mAdapter));
+        }
+    }
+
+    auto collectTask = mCollectTask;
+    auto index = mAdapter.index(mRange);
+    auto size = mRange.size();
+    mAdapter.run(mOp, mRange, [collectTask, index, size](typename VariantType&& result)->void
+    {
+        collectTask->notifyCompletion(index, std::move(result), size);
+    } );
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT, class TRANGE>
+void RangeTask<TRESULT, TRANGE>::performAdaptive(std::true_type isAdaptive)
+{
+    releasePending();
+
+    auto manager = mManager.lock();
+    auto collectTask = mCollectTask;
+    while(0 != mRange.size() && collectTask->isValid())
+    {
+        auto chunkSize = mPartitioner->chunkSize();
+        if(manager && mRange.size() > chunkSize && mRange.isDivisible() && mPartitioner->shouldSplit())
+        {
+            manager->run(std::make_shared<RangeTask>(mManager, mOp, mRange.split(), mCollectTask, mPartitioner, 
+                mAdapter));
+            continue;
+        }
+
+        auto begin = mRange.begin();
+        auto size = std::min(chunkSize, mRange.size());
+        auto start = std::chrono::high_resolution_clock::now();
+        mAdapter.run(mOp, BlockedRange(begin, begin + size, mRange.grainSize()), 
+            [collectTask, begin, size](typename VariantType&& result)->void
+        {
+            collectTask->notifyCompletion(begin, std::move(result), size);
+        } );
+        mPartitioner->record(size, std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start));
+        mRange = BlockedRange(begin + size, mRange.end(), mRange.grainSize());
+    }
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT, class TRANGE>
+void RangeTask<TRESULT, TRANGE>::performAdaptive(std::false_type isAdaptive)
+{
+    //a partitioner is refused on construction for ranges which cannot be run adaptively
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT, class TRANGE>
+void RangeTask<TRESULT, TRANGE>::notifyCancel()
+{
+    releasePending();
+    mCollectTask->cancel();
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT, class TRANGE>
+void RangeTask<TRESULT, TRANGE>::releasePending()
+{
+    //a queued task stops counting as waiting once taken, cancelled or dropped, so splitting can carry on
+    if(mIsPending)
+    {
+        mIsPending = false;
+        mPartitioner->started();
+    }
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT, class TRANGE>
+void RangeTask<TRESULT, TRANGE>::notifyException(std::exception_ptr ex)
+{
+    mCollectTask->notifyException(ex);
+}
+
+}
+}
+}
\ No newline at end of file
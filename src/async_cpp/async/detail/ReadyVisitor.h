@@ -34,7 +34,8 @@ bool ReadyVisitor<T>::operator()(const T&) const
 template<class T>
 bool ReadyVisitor<T>::operator()(const AsyncResult& value) const
 {
-    return value.isReady();
+    //results created finished have no future to poll
+    return value.isImmediate() || value.isReady();
 }
 
 //------------------------------------------------------------------------------
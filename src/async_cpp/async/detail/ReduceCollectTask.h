@@ -0,0 +1,149 @@
+#pragma once
+#include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/detail/IParallelTask.h"
+#include "async_cpp/async/detail/ResultState.h"
+
+#include <boost/optional.hpp>
+#include <atomic>
+#include <functional>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Task which receives the single combined value of a parallel reduction, and passes it to a then function.
+ */
+//------------------------------------------------------------------------------
+template<class TRESULT>
+class ReduceCollectTask : public IParallelTask<TRESULT> {
+public:
+    typedef typename std::function<void(std::exception_ptr, TRESULT*)> then_t;
+
+    /**
+     * Create a task which will invoke a then function once the reduced value is known.
+     * @param thenFunction Function invoked with the reduced value, or an exception if the reduction failed
+     */
+    ReduceCollectTask(std::weak_ptr<tasks::IManager> mgr, typename then_t thenFunction);
+    virtual ~ReduceCollectTask();
+
+    AsyncResult result();
+
+    /**
+     * Check if the reduction is still wanted. Reduction stops when cancelled or a task fails.
+     * @return True if reduction is still wanted
+     */
+    inline bool isValid() const;
+
+    /**
+     * Store the reduced value, invoking the then function with it on the calling thread.
+     * @param result Value produced by combining all partial results
+     */
+    void notifyCompletion(TRESULT&& result);
+    virtual void notifyException(std::exception_ptr ex) final;
+
+protected:
+    virtual void performSpecific() final;
+    virtual void notifyCancel() final;
+
+private:
+    boost::optional<TRESULT> mResult;
+    std::function<void(std::exception_ptr, TRESULT*)> mTask;
+    std::shared_ptr<ResultState> mState;
+    std::atomic_bool mValid;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TRESULT>
+ReduceCollectTask<TRESULT>::ReduceCollectTask(std::weak_ptr<tasks::IManager> mgr, typename then_t thenFunction)
+    : IParallelTask(mgr),
+      mState(std::make_shared<ResultState>())
+{
+    mValid.store(true);
+    auto state = mState;
+    mTask = [thenFunction, state](std::exception_ptr ex, TRESULT* result)->void
+    {
+        //cancellation and failures may race with completion, only finish once
+        if(!state->claim()) return;
+
+        try
+        {
+            if(thenFunction) thenFunction(ex, result);
+        }
+        catch(...)
+        {
+            ex = std::current_exception();
+        }
+
+        state->complete(ex);
+    };
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+ReduceCollectTask<TRESULT>::~ReduceCollectTask()
+{
+    //dropped without finishing, such as when an operation never reports its result or the task is never run, so 
+    //consumers are not left waiting
+    if(mState->claim())
+    {
+        mState->complete(std::make_exception_ptr(std::runtime_error("Abandoned")));
+    }
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+AsyncResult ReduceCollectTask<TRESULT>::result()
+{
+    return AsyncResult(mState, shared_from_this());
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+bool ReduceCollectTask<TRESULT>::isValid() const
+{
+    return mValid;
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+void ReduceCollectTask<TRESULT>::notifyCompletion(TRESULT&& result)
+{
+    if(mValid)
+    {
+        mResult = std::move(result);
+        perform();
+    }
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+void ReduceCollectTask<TRESULT>::performSpecific()
+{
+    if(mValid && mResult)
+    {
+        mTask(nullptr, mResult.get_ptr());
+    }
+}
+
+//------------------------------------------------------------------------------
+template<class T>
+void ReduceCollectTask<T>::notifyCancel()
+{
+    //mark as invalid, so outstanding tasks stop reducing
+    mValid.exchange(false);
+    mTask(std::make_exception_ptr(std::runtime_error("Cancelled")), nullptr);
+}
+
+//------------------------------------------------------------------------------
+template<class T>
+void ReduceCollectTask<T>::notifyException(std::exception_ptr ex)
+{
+    mValid.exchange(false);
+    mTask(ex, nullptr);
+}
+
+}
+}
+}
\ No newline at end of file
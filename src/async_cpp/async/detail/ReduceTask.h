@@ -0,0 +1,175 @@
+#pragma once
+#include "async_cpp/async/detail/BlockedRange.h"
+#include "async_cpp/async/detail/ReduceCollectTask.h"
+
+#include <boost/optional.hpp>
+#include <functional>
+#include <mutex>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Parallel task which reduces a range of indices to a single partial result. The range is split in half until no larger 
+ * than its grain size, with each upper half queued as another reduce task. Each split forms a join in a tree, where the 
+ * last half to finish combines both partials and carries on up the tree, so partials are combined in parallel and in 
+ * index order.
+ */
+//------------------------------------------------------------------------------
+template<class TRESULT>
+class ReduceTask : public IParallelTask<TRESULT> {
+public:
+    typedef std::function<TRESULT(const size_t, const size_t)> operation_t;
+    typedef std::function<TRESULT(TRESULT&&, TRESULT&&)> combine_t;
+
+    /**
+     * Create a task which reduces a range of indices.
+     * @param op Operation reducing a chunk of indices [begin, end) to a partial result
+     * @param combine Operation combining two adjacent partial results, with the lower indices on the left
+     * @param range Indices to reduce
+     * @param collectTask Task receiving the fully combined result
+     */
+    ReduceTask(std::weak_ptr<tasks::IManager> mgr, 
+        operation_t op,
+        combine_t combine,
+        BlockedRange range,
+        std::shared_ptr<ReduceCollectTask<TRESULT>> collectTask);
+    virtual ~ReduceTask();
+    virtual void notifyException(std::exception_ptr ex) final;
+
+protected:
+    virtual void performSpecific() final;
+    virtual void notifyCancel() final;
+
+private:
+    struct Join {
+        Join(std::shared_ptr<Join> parent, const bool isLeft);
+
+        std::shared_ptr<Join> mParent;
+        bool mIsLeft;
+        std::mutex mMutex;
+        boost::optional<TRESULT> mPartial;
+    };
+
+    ReduceTask(std::weak_ptr<tasks::IManager> mgr, 
+        operation_t op,
+        combine_t combine,
+        BlockedRange range,
+        std::shared_ptr<ReduceCollectTask<TRESULT>> collectTask,
+        std::shared_ptr<Join> join,
+        const bool isLeft);
+
+    operation_t mOp;
+    combine_t mCombine;
+    BlockedRange mRange;
+    std::shared_ptr<ReduceCollectTask<TRESULT>> mCollectTask;
+    std::shared_ptr<Join> mJoin;
+    bool mIsLeft;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TRESULT>
+ReduceTask<TRESULT>::Join::Join(std::shared_ptr<Join> parent, const bool isLeft)
+    : mParent(parent), mIsLeft(isLeft)
+{
+
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+ReduceTask<TRESULT>::ReduceTask(std::weak_ptr<tasks::IManager> mgr, 
+        operation_t op,
+        combine_t combine,
+        BlockedRange range,
+        std::shared_ptr<ReduceCollectTask<TRESULT>> collectTask)
+    : IParallelTask(mgr), mOp(op), mCombine(combine), mRange(range), mCollectTask(collectTask), mIsLeft(true)
+{
+    if(!mCollectTask) { throw(std::invalid_argument("ReduceTask: No collect task")); }
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+ReduceTask<TRESULT>::ReduceTask(std::weak_ptr<tasks::IManager> mgr, 
+        operation_t op,
+        combine_t combine,
+        BlockedRange range,
+        std::shared_ptr<ReduceCollectTask<TRESULT>> collectTask,
+        std::shared_ptr<Join> join,
+        const bool isLeft)
+    : IParallelTask(mgr), mOp(op), mCombine(combine), mRange(range), mCollectTask(collectTask), mJoin(join), mIsLeft(isLeft)
+{
+
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+ReduceTask<TRESULT>::~ReduceTask()
+{
+
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+void ReduceTask<TRESULT>::performSpecific()
+{
+    //results are no longer wanted if reduction was cancelled or failed
+    if(!mCollectTask->isValid()) return;
+
+    auto manager = mManager.lock();
+    if(manager)
+    {
+        while(mRange.isDivisible())
+        {
+            auto join = std::make_shared<Join>(mJoin, mIsLeft);
+            manager->run(std::shared_ptr<ReduceTask>(
+                new ReduceTask(mManager, mOp, mCombine, mRange.split(), mCollectTask, join, false)));
+            mJoin = join;
+            mIsLeft = true;
+        }
+    }
+
+    auto partial = mOp(mRange.begin(), mRange.end());
+
+    //first half to reach a join leaves its partial, the second combines both and moves up
+    auto join = mJoin;
+    auto isLeft = mIsLeft;
+    while(join)
+    {
+        {
+            std::lock_guard<std::mutex> lock(join->mMutex);
+            if(!join->mPartial)
+            {
+                join->mPartial = std::move(partial);
+                return;
+            }
+        }
+
+        if(!mCollectTask->isValid()) return;
+        partial = isLeft ? mCombine(std::move(partial), std::move(*join->mPartial)) 
+            : mCombine(std::move(*join->mPartial), std::move(partial));
+        isLeft = join->mIsLeft;
+        join = join->mParent;
+    }
+
+    mCollectTask->notifyCompletion(std::move(partial));
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+void ReduceTask<TRESULT>::notifyCancel()
+{
+    mCollectTask->cancel();
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+void ReduceTask<TRESULT>::notifyException(std::exception_ptr ex)
+{
+    mCollectTask->notifyException(ex);
+}
+
+}
+}
+}
\ No newline at end of file
@@ -0,0 +1,153 @@
+#pragma once
+#include "async_cpp/async/AsyncResult.h"
+
+#include "async_cpp/tasks/IManager.h"
+#include "async_cpp/tasks/Task.h"
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#include <stdexcept>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Awaitable for an AsyncResult. The awaiting coroutine is resumed as a task on a manager once the result is ready,
+ * using a continuation on the result. If the manager is gone by then, the coroutine is resumed by the thread completing 
+ * the result and the co_await expression throws.
+ * Without a manager, the result is waited on by the awaiting thread.
+ */
+//------------------------------------------------------------------------------
+class ResultAwaiter {
+public:
+    /**
+     * Create an awaitable for a result.
+     * @param result Result to wait on
+     * @param manager Manager to resume the awaiting coroutine, empty to wait on the awaiting thread
+     */
+    inline ResultAwaiter(AsyncResult result, std::weak_ptr<tasks::IManager> manager);
+
+    inline bool await_ready() const;
+    inline bool await_suspend(std::coroutine_handle<> handle);
+    inline void await_resume();
+
+private:
+    class ResumeTask;
+
+    AsyncResult mResult;
+    std::weak_ptr<tasks::IManager> mManager;
+    bool mCancelled;
+};
+
+/**
+ * Task which resumes a coroutine awaiting a result.
+ */
+//------------------------------------------------------------------------------
+class ResultAwaiter::ResumeTask : public tasks::Task {
+public:
+    inline ResumeTask(ResultAwaiter& awaiter, std::coroutine_handle<> handle);
+    inline virtual ~ResumeTask();
+
+protected:
+    inline virtual void performSpecific() final;
+    inline virtual void notifyCancel() final;
+
+private:
+    ResultAwaiter& mAwaiter;
+    std::coroutine_handle<> mHandle;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+ResultAwaiter::ResultAwaiter(AsyncResult result, std::weak_ptr<tasks::IManager> manager)
+    : mResult(std::move(result)), mManager(manager), mCancelled(false)
+{
+
+}
+
+//------------------------------------------------------------------------------
+bool ResultAwaiter::await_ready() const
+{
+    return mResult.isReady();
+}
+
+//------------------------------------------------------------------------------
+bool ResultAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    if(mManager.expired())
+    {
+        //nothing to resume on, wait when resuming
+        return false;
+    }
+    auto weakManager = mManager;
+    auto awaiter = this;
+    mResult.onComplete([weakManager, awaiter, handle](std::exception_ptr)->void
+    {
+        //the result may complete long after the manager was released
+        auto manager = weakManager.lock();
+        if(!manager)
+        {
+            awaiter->mCancelled = true;
+            handle.resume();
+            return;
+        }
+        manager->run(std::make_shared<ResumeTask>(*awaiter, handle));
+    } );
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void ResultAwaiter::await_resume()
+{
+    if(mCancelled) { throw(std::runtime_error("Cancelled")); }
+    mResult.check();
+}
+
+//------------------------------------------------------------------------------
+ResultAwaiter::ResumeTask::ResumeTask(ResultAwaiter& awaiter, std::coroutine_handle<> handle)
+    : Task(), mAwaiter(awaiter), mHandle(handle)
+{
+
+}
+
+//------------------------------------------------------------------------------
+ResultAwaiter::ResumeTask::~ResumeTask()
+{
+
+}
+
+//------------------------------------------------------------------------------
+void ResultAwaiter::ResumeTask::performSpecific()
+{
+    mHandle.resume();
+}
+
+//------------------------------------------------------------------------------
+void ResultAwaiter::ResumeTask::notifyCancel()
+{
+    //coroutine must still be resumed, otherwise it is never destroyed
+    mAwaiter.mCancelled = true;
+    mHandle.resume();
+}
+
+}
+
+/**
+ * Await an AsyncResult from a coroutine. If awaited while performing a managed task, the coroutine is resumed on 
+ * that manager. Managers not owned by a shared_ptr cannot be tracked once released, so the result is instead waited 
+ * on by the awaiting thread.
+ * @param result Result to wait on
+ * @return Awaitable for result
+ */
+inline detail::ResultAwaiter operator co_await(AsyncResult result)
+{
+    auto manager = tasks::IManager::current();
+    return detail::ResultAwaiter(std::move(result), 
+        manager ? manager->weak_from_this() : std::weak_ptr<tasks::IManager>());
+}
+
+}
+}
+
+#endif
\ No newline at end of file
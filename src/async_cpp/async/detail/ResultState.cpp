@@ -0,0 +1,303 @@
+#include "async_cpp/async/detail/ResultState.h"
+
+#include "async_cpp/tasks/IManager.h"
+#include "async_cpp/tasks/Task.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Task which watches the source future of a state, completing the state once the future is ready. Checks back off 
+ * exponentially so a slow future does not keep workers busy. Each check is rescheduled on the manager performing it, 
+ * which need not be owned by a shared_ptr. If that manager is shutting down, the state's thread takes over.
+ */
+//------------------------------------------------------------------------------
+class ResultState::ObserveTask : public tasks::Task {
+public:
+    ObserveTask(std::shared_ptr<ResultState> state, const std::chrono::microseconds delay)
+        : Task(), mState(state), mDelay(delay)
+    {
+
+    }
+
+    virtual ~ObserveTask()
+    {
+
+    }
+
+protected:
+    virtual void performSpecific() final
+    {
+        if(mState->observeSource())
+        {
+            return;
+        }
+
+        //the manager performing this task is alive until it returns
+        auto manager = tasks::IManager::current();
+        if(!manager || !manager->isRunning())
+        {
+            mState->waitOnSource();
+            return;
+        }
+        auto delay = std::min<std::chrono::microseconds>(2 * mDelay, std::chrono::milliseconds(10));
+        manager->run(std::make_shared<ObserveTask>(mState, delay), 
+            std::chrono::high_resolution_clock::now() + delay);
+    }
+
+    virtual void notifyCancel() final
+    {
+        //manager shutdown, continuations still need to run
+        if(!mState->observeSource())
+        {
+            mState->waitOnSource();
+        }
+    }
+
+private:
+    std::shared_ptr<ResultState> mState;
+    std::chrono::microseconds mDelay;
+};
+
+//------------------------------------------------------------------------------
+ResultState::ResultState()
+    : mIsCompleting(false)
+{
+    mIsReady.store(false);
+    mIsClaimed.store(false);
+    mIsWatched.store(false);
+    mIsStopping.store(false);
+}
+
+//------------------------------------------------------------------------------
+ResultState::ResultState(std::shared_future<bool> source)
+    : mIsCompleting(false), mSource(source)
+{
+    mIsReady.store(false);
+    mIsClaimed.store(true);
+    mIsWatched.store(false);
+    mIsStopping.store(false);
+}
+
+//------------------------------------------------------------------------------
+ResultState::~ResultState()
+{
+    if(mWatcher.joinable())
+    {
+        if(mWatcher.get_id() == std::this_thread::get_id())
+        {
+            //released by the watcher once it completed this state, it has nothing left to do
+            mWatcher.detach();
+        }
+        else
+        {
+            //nothing is left to wait on this state, stop watching rather than blocking until the source is ready, which 
+            //may never happen. Continuations only run if the source is already ready
+            mIsStopping.store(true);
+            mWatcher.join();
+            observeSource();
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+bool ResultState::claim()
+{
+    return !mIsClaimed.exchange(true);
+}
+
+//------------------------------------------------------------------------------
+bool ResultState::complete(std::exception_ptr ex)
+{
+    std::vector<continuation_t> continuations;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if(mIsCompleting)
+        {
+            return false;
+        }
+        mIsCompleting = true;
+        mException = ex;
+        continuations.swap(mContinuations);
+    }
+
+    //run continuations before releasing waiters, so anything waiting sees their effects. Continuations attached while 
+    //running are queued and run here too
+    while(true)
+    {
+        for(auto& continuation : continuations)
+        {
+            try
+            {
+                continuation(ex);
+            }
+            catch(...)
+            {
+                //continuation caused an exception, other consumers still need to be notified
+            }
+        }
+        continuations.clear();
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        continuations.swap(mContinuations);
+        if(continuations.empty())
+        {
+            mIsReady.store(true);
+            break;
+        }
+    }
+    mCompleteSignal.notify_all();
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool ResultState::isReady()
+{
+    observeSource();
+    return mIsReady;
+}
+
+//------------------------------------------------------------------------------
+void ResultState::wait()
+{
+    //a cancelled state is complete without its source
+    if(mSource.valid() && !mIsReady)
+    {
+        mSource.wait();
+        observeSource();
+    }
+
+    //another thread may still be running continuations
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCompleteSignal.wait(lock, [this]()->bool 
+    {
+        return mIsReady;
+    } );
+}
+
+//------------------------------------------------------------------------------
+bool ResultState::waitUntil(const std::chrono::steady_clock::time_point& time)
+{
+    if(mSource.valid() && !mIsReady)
+    {
+        mSource.wait_until(time);
+        observeSource();
+    }
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    return mCompleteSignal.wait_until(lock, time, [this]()->bool 
+    {
+        return mIsReady;
+    } );
+}
+
+//------------------------------------------------------------------------------
+std::exception_ptr ResultState::exception() const
+{
+    return mException;
+}
+
+//------------------------------------------------------------------------------
+void ResultState::addContinuation(continuation_t continuation)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if(!mIsReady)
+        {
+            mContinuations.emplace_back(std::move(continuation));
+            continuation = nullptr;
+        }
+    }
+
+    if(continuation)
+    {
+        continuation(mException);
+    }
+    else if(mSource.valid() && !observeSource() && !mIsWatched.exchange(true))
+    {
+        //nothing completes a future backed state, have the current manager watch it, or a thread wait on it if not
+        //attached from a worker. One watcher completes the state for every continuation
+        auto manager = tasks::IManager::current();
+        if(manager)
+        {
+            manager->run(std::make_shared<ObserveTask>(shared_from_this(), std::chrono::microseconds(50)));
+        }
+        else
+        {
+            waitOnSource();
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+void ResultState::waitOnSource()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if(mWatcher.joinable())
+    {
+        return;
+    }
+
+    //the thread only holds the state while completing it, so the state can still be released and join it. Until then 
+    //the state outlives the thread, so its flags can be checked to stop once completed some other way, such as by 
+    //being cancelled, or once released. A ready source wakes the wait at once, waits only back off so stopping stays 
+    //prompt without the thread spinning
+    auto source = mSource;
+    auto self = this;
+    std::weak_ptr<ResultState> weakState(shared_from_this());
+    mWatcher = std::thread([source, self, weakState]()->void
+    {
+        std::chrono::microseconds delay(50);
+        while(std::future_status::ready != source.wait_for(delay))
+        {
+            if(self->mIsReady || self->mIsStopping) return;
+            delay = std::min<std::chrono::microseconds>(2 * delay, std::chrono::milliseconds(10));
+        }
+        auto state = weakState.lock();
+        if(state)
+        {
+            state->observeSource();
+        }
+    } );
+}
+
+//------------------------------------------------------------------------------
+bool ResultState::observeSource()
+{
+    if(!mSource.valid())
+    {
+        return mIsReady;
+    }
+    if(mIsReady)
+    {
+        return true;
+    }
+#ifdef _MSC_VER //wait_for is broken in VC11 have to use MS specific _Is_ready
+    if(!mSource._Is_ready())
+#else
+    if(std::future_status::ready != mSource.wait_for(std::chrono::milliseconds(0)))
+#endif
+    {
+        return false;
+    }
+
+    std::exception_ptr ex;
+    try
+    {
+        mSource.get();
+    }
+    catch(...)
+    {
+        ex = std::current_exception();
+    }
+    complete(ex);
+    return true;
+}
+
+}
+}
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include "async_cpp/async/Async.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Completion state shared by all copies of an AsyncResult. Any number of consumers may wait on the state or attach 
+ * continuations, which are invoked once by the thread completing the state.
+ */
+//------------------------------------------------------------------------------
+class ASYNC_CPP_ASYNC_API ResultState : public std::enable_shared_from_this<ResultState> {
+public:
+    typedef std::function<void(std::exception_ptr)> continuation_t;
+
+    /**
+     * Create a state that will be completed by its producer.
+     */
+    ResultState();
+    /**
+     * Create a state completed by a future. The state completes when the future is observed to be ready, by a wait
+     * or ready check. The first continuation attached while pending starts a single watcher for the state: the current 
+     * worker's manager if attached from a worker, otherwise a thread owned by the state, which is stopped and joined 
+     * when the state is destroyed.
+     * @param source Future to complete from
+     */
+    ResultState(std::shared_future<bool> source);
+    ~ResultState();
+
+    /**
+     * Claim the right to complete this state. Allows a producer to run completion work only once.
+     * @return True if this is the first claim
+     */
+    bool claim();
+
+    /**
+     * Complete this state, invoking any attached continuations. Waiting consumers are released only once continuations
+     * have run, so continuations must not wait on this state.
+     * @param ex Exception to complete with, null if successful
+     * @return True if state was completed by this call
+     */
+    bool complete(std::exception_ptr ex);
+
+    /**
+     * Check if this state is complete.
+     * @return True if complete
+     */
+    bool isReady();
+
+    /**
+     * Wait for this state to complete.
+     */
+    void wait();
+
+    /**
+     * Wait until a point in time for this state to complete.
+     * @param time Time to stop waiting at
+     * @return True if complete
+     */
+    bool waitUntil(const std::chrono::steady_clock::time_point& time);
+
+    /**
+     * Retrieve the exception this state completed with. Only valid once complete.
+     * @return Exception, null if successful
+     */
+    std::exception_ptr exception() const;
+
+    /**
+     * Attach a continuation to this state. If already complete, the continuation is invoked immediately.
+     * @param continuation Function to invoke with the exception the state completed with, null if successful
+     */
+    void addContinuation(continuation_t continuation);
+
+private:
+    class ObserveTask;
+
+    ResultState(const ResultState& other);
+
+    bool observeSource();
+    void waitOnSource();
+
+    std::mutex mMutex;
+    std::condition_variable mCompleteSignal;
+    std::atomic_bool mIsReady;
+    std::atomic_bool mIsClaimed;
+    std::atomic_bool mIsWatched;
+    std::atomic_bool mIsStopping;
+    bool mIsCompleting;
+    std::exception_ptr mException;
+    std::vector<continuation_t> mContinuations;
+    std::shared_future<bool> mSource;
+    std::thread mWatcher;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+
+}
+}
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+#pragma once
+#include "async_cpp/async/detail/PhasedTask.h"
+
+#include <atomic>
+#include <limits>
+
+namespace async_cpp {
+namespace async {
+namespace detail {
+
+/**
+ * Index reported by a search which found no match.
+ */
+const size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+
+/**
+ * Run a search of indices [0, size) for one passing a test as part of a phased task, in parallel chunks. The index found 
+ * is shared between chunks, so once found, chunks which can no longer improve on it stop or skip their indices.
+ * @param task Phased task to run the search phase on
+ * @param size Number of indices to search
+ * @param grainSize Largest number of indices searched by a single task
+ * @param test Test of an index, true if it is a match
+ * @param findFirst Find the lowest matching index, otherwise stop at any match
+ * @param next Step run with the index found, or NOT_FOUND if none matched
+ */
+template<class TRESULT>
+inline void searchIndices(std::shared_ptr<PhasedTask<TRESULT>> task,
+    const size_t size,
+    const size_t grainSize,
+    std::function<bool(const size_t)> test,
+    const bool findFirst,
+    std::function<void(const size_t)> next);
+
+/**
+ * Parallel search of a set of indices, producing an outcome from the index found. Shared by the searches over data, 
+ * which differ only in the test of each index, whether they need the first match, and what they report.
+ */
+//------------------------------------------------------------------------------
+template<class TRESULT>
+class IndexSearch {
+public:
+    typedef typename PhasedTask<TRESULT>::then_t then_t;
+    typedef std::function<TRESULT(const size_t)> outcome_t;
+
+    /**
+     * Create a search of a set of indices.
+     * @param manager Manager to run tasks against
+     * @param test Test of an index, true if it is a match
+     * @param size Number of indices to search
+     * @param grainSize Largest number of indices searched by a single task, chosen from the size if zero
+     * @param findFirst Find the lowest matching index, otherwise stop at any match
+     * @param outcome Operation producing the result from the index found, or NOT_FOUND if none matched
+     */
+    IndexSearch(tasks::ManagerPtr manager, 
+        std::function<bool(const size_t)> test,
+        const size_t size,
+        const size_t grainSize,
+        const bool findFirst,
+        outcome_t outcome);
+
+    /**
+     * Run the search, invoking a task with its outcome
+     * @param onFinishTask Task to run when search is complete
+     * @return AsyncResult that holds a future completion status, either successful or exception
+     */
+    AsyncResult then(typename then_t onFinishTask);
+
+    /**
+     * Cancel outstanding tasks
+     */
+    void cancel();
+
+private:
+    tasks::ManagerPtr mManager;
+    std::function<bool(const size_t)> mTest;
+    size_t mSize;
+    size_t mGrainSize;
+    bool mFindFirst;
+    outcome_t mOutcome;
+    std::shared_ptr<tasks::Task> mTask;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+template<class TRESULT>
+void searchIndices(std::shared_ptr<PhasedTask<TRESULT>> task,
+    const size_t size,
+    const size_t grainSize,
+    std::function<bool(const size_t)> test,
+    const bool findFirst,
+    std::function<void(const size_t)> next)
+{
+    auto found = std::make_shared<std::atomic<size_t>>(NOT_FOUND);
+    auto searchChunk = [found, test, findFirst](const size_t begin, const size_t end)->void
+    {
+        for(size_t i = begin; i < end; ++i)
+        {
+            //stop once a match was found which this chunk cannot improve on
+            auto current = found->load(std::memory_order_relaxed);
+            if(findFirst ? current < i : current != NOT_FOUND) return;
+
+            if(test(i))
+            {
+                //lower the shared index to this match, unless another chunk already found a lower one. A failed exchange
+                //reloads current, so retry only while this match is still lower
+                while(i < current)
+                {
+                    if(found->compare_exchange_weak(current, i))
+                    {
+                        break;
+                    }
+                }
+                return;
+            }
+        }
+    };
+
+    task->runPhase(size, grainSize, searchChunk, [found, next]()->void
+    {
+        next(found->load());
+    } );
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+IndexSearch<TRESULT>::IndexSearch(tasks::ManagerPtr manager, 
+        std::function<bool(const size_t)> test,
+        const size_t size,
+        const size_t grainSize,
+        const bool findFirst,
+        outcome_t outcome)
+    : mManager(manager), mTest(test), mSize(size), mGrainSize(grainSize), mFindFirst(findFirst), mOutcome(outcome)
+{
+    if(0 == mGrainSize) { mGrainSize = BlockedRange::defaultGrainSize(mSize); }
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+AsyncResult IndexSearch<TRESULT>::then(typename then_t onFinishOp)
+{
+    auto task = std::make_shared<PhasedTask<TRESULT>>(mManager, onFinishOp);
+    mTask = task;
+    auto result = task->result();
+    auto outcome = mOutcome;
+    searchIndices<TRESULT>(task, mSize, mGrainSize, mTest, mFindFirst, [task, outcome](const size_t index)->void
+    {
+        auto value = outcome(index);
+        task->finish(&value);
+    } );
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<class TRESULT>
+void IndexSearch<TRESULT>::cancel()
+{
+    if(mTask) mTask->cancel();
+}
+
+}
+}
+}
\ No newline at end of file
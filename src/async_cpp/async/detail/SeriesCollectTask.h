@@ -1,6 +1,7 @@
 #pragma once
 #include "async_cpp/async/detail/ISeriesTask.h"
 #include "async_cpp/async/detail/ReadyVisitor.h"
+#include "async_cpp/async/detail/ResultState.h"
 #include "async_cpp/async/detail/ValueVisitor.h"
 
 namespace async_cpp {
@@ -23,7 +24,8 @@ protected:
 
 private:
     typename then_t mThenFunc;
-    std::packaged_task<bool(std::exception_ptr, typename VariantType&&)> mTask;
+    std::function<void(std::exception_ptr, typename VariantType&&)> mTask;
+    std::shared_ptr<ResultState> mState;
 };
 
 //inline implementations
@@ -32,10 +34,15 @@ template<class TRESULT>
 SeriesCollectTask<TRESULT>::SeriesCollectTask(std::weak_ptr<tasks::IManager> mgr,
                                      typename then_t thenFunc)
                                      : ISeriesTask<TRESULT>(mgr), 
-                                     mThenFunc(thenFunc)
+                                     mThenFunc(thenFunc),
+                                     mState(std::make_shared<ResultState>())
 {
-    mTask = std::packaged_task<bool(std::exception_ptr, typename VariantType&&)>([thenFunc](std::exception_ptr ex, typename VariantType&& previous)->bool 
+    auto state = mState;
+    mTask = [thenFunc, state](std::exception_ptr ex, typename VariantType&& previous)->void 
     {
+        //cancellation and failures may race with completion, only finish once
+        if(!state->claim()) return;
+
         try
         {
             thenFunc(ex, boost::apply_visitor(ValueVisitor<TRESULT>(), previous));
@@ -44,16 +51,20 @@ SeriesCollectTask<TRESULT>::SeriesCollectTask(std::weak_ptr<tasks::IManager> mgr
         {
             ex = std::current_exception();
         }
-        if(ex) std::rethrow_exception(ex);
-        return true;
-    } );
+        state->complete(ex);
+    };
 }
 
 //------------------------------------------------------------------------------
 template<class TRESULT>
 SeriesCollectTask<TRESULT>::~SeriesCollectTask()
 {
-
+    //dropped without finishing, such as when an operation never reports its result or the task is never run, so 
+    //consumers are not left waiting
+    if(mState->claim())
+    {
+        mState->complete(std::make_exception_ptr(std::runtime_error("Abandoned")));
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -67,7 +78,7 @@ void SeriesCollectTask<TRESULT>::performSpecific()
 template<class TRESULT>
 AsyncResult SeriesCollectTask<TRESULT>::result()
 {
-    return AsyncResult(mTask.get_future());
+    return AsyncResult(mState, shared_from_this());
 }
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,336 @@
+#include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/ParallelFor.h"
+#include "async_cpp/async/detail/ParallelCollectTask.h"
+#include "async_cpp/async/detail/ReadyVisitor.h"
+
+#include "async_cpp/tasks/AsioManager.h"
+#include "async_cpp/tasks/Task.h"
+
+#include <atomic>
+#include <thread>
+
+#pragma warning(disable:4251)
+#include <gtest/gtest.h>
+
+using namespace async_cpp;
+using namespace async_cpp::async;
+
+class ContinueTask : public tasks::Task
+{
+public:
+    ContinueTask(AsyncResult result, std::function<void(std::exception_ptr)> continuation) 
+        : mResult(result), mContinuation(continuation)
+    {
+
+    }
+
+    virtual ~ContinueTask()
+    {
+
+    }
+
+private:
+    virtual void performSpecific() final
+    {
+        mResult.onComplete(mContinuation);
+    }
+
+    AsyncResult mResult;
+    std::function<void(std::exception_ptr)> mContinuation;
+};
+
+TEST(ASYNC_RESULT_TEST, IMMEDIATE)
+{
+    AsyncResult success;
+    EXPECT_TRUE(success.isImmediate());
+    EXPECT_TRUE(success.isReady());
+    EXPECT_NO_THROW(success.check());
+    EXPECT_NO_THROW(success.check());
+
+    AsyncResult failure(std::make_exception_ptr(std::runtime_error("failed")));
+    EXPECT_TRUE(failure.isImmediate());
+    EXPECT_TRUE(failure.isReady());
+    EXPECT_THROW(failure.check(), std::runtime_error);
+
+    detail::ReadyVisitor<int> isReady;
+    EXPECT_TRUE(isReady(success));
+    EXPECT_TRUE(isReady(failure));
+}
+
+TEST(ASYNC_RESULT_TEST, FUTURE)
+{
+    std::promise<bool> promise;
+    AsyncResult result(promise.get_future());
+    EXPECT_FALSE(result.isImmediate());
+    EXPECT_FALSE(result.isReady());
+
+    promise.set_value(true);
+    EXPECT_TRUE(result.isReady());
+    EXPECT_NO_THROW(result.check());
+}
+
+TEST(ASYNC_RESULT_TEST, NESTED_CHECK)
+{
+    //single worker, nested check would block the only worker without helping
+    auto manager(std::make_shared<tasks::AsioManager>(1));
+
+    auto outerOp = [manager](size_t index, ParallelFor<size_t>::callback_t cb)->void {
+        size_t innerSum = 0;
+        auto innerOp = [](size_t innerIndex, ParallelFor<size_t>::callback_t innerCb)->void {
+            innerCb(innerIndex);
+        };
+        auto inner = ParallelFor<size_t>(manager, innerOp, 4).then([&innerSum](std::exception_ptr ex, std::vector<size_t>&& results)->void {
+            if(ex) std::rethrow_exception(ex);
+            for(auto val : results) innerSum += val;
+        } );
+        inner.check();
+        cb(index + innerSum);
+    };
+
+    auto result = ParallelFor<size_t>(manager, outerOp, 3).then([](std::exception_ptr ex, std::vector<size_t>&& results)->void {
+        if(ex) std::rethrow_exception(ex);
+        if(results.size() != 3 || results[0] != 6 || results[1] != 7 || results[2] != 8)
+        {
+            throw(std::runtime_error("Nested results incorrect"));
+        }
+    } );
+
+    EXPECT_NO_THROW(result.check());
+
+    manager->shutdown();
+}
+
+TEST(ASYNC_RESULT_TEST, WAIT_FOR)
+{
+    std::promise<bool> promise;
+    AsyncResult result(promise.get_future());
+    EXPECT_EQ(tasks::WaitStatus::Timeout, result.waitFor(std::chrono::milliseconds(1)));
+
+    promise.set_value(true);
+    EXPECT_EQ(tasks::WaitStatus::Ready, result.waitFor(std::chrono::milliseconds(1)));
+    EXPECT_EQ(tasks::WaitStatus::Ready, result.waitUntil(std::chrono::steady_clock::now()));
+    EXPECT_NO_THROW(result.check());
+
+    AsyncResult failure(std::make_exception_ptr(std::runtime_error("failed")));
+    EXPECT_EQ(tasks::WaitStatus::Failed, failure.waitFor(std::chrono::milliseconds(1)));
+}
+
+TEST(ASYNC_RESULT_TEST, CANCEL_ON_TIMEOUT)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(1));
+    std::atomic<size_t> nbPerformed(0);
+
+    auto op = [&nbPerformed](size_t index, ParallelFor<size_t>::callback_t cb)->void {
+        ++nbPerformed;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        cb(index);
+    };
+    auto result = ParallelFor<size_t>(manager, op, 10).then([](std::exception_ptr ex, std::vector<size_t>&&)->void {
+        if(ex) std::rethrow_exception(ex);
+    } );
+
+    EXPECT_EQ(tasks::WaitStatus::Timeout, result.waitFor(std::chrono::milliseconds(5), true));
+    EXPECT_EQ(tasks::WaitStatus::Failed, result.waitFor(std::chrono::seconds(5)));
+    EXPECT_THROW(result.check(), std::runtime_error);
+
+    //remaining operations are skipped once cancelled
+    manager->waitForTasksToComplete();
+    EXPECT_GT(10, nbPerformed.load());
+
+    manager->shutdown();
+}
+
+TEST(ASYNC_RESULT_TEST, SHARED)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(3));
+    std::atomic<size_t> nbComputed(0);
+
+    auto op = [&nbComputed](size_t index, ParallelFor<size_t>::callback_t cb)->void {
+        ++nbComputed;
+        cb(index);
+    };
+    auto result = ParallelFor<size_t>(manager, op, 5).then([](std::exception_ptr ex, std::vector<size_t>&&)->void {
+        if(ex) std::rethrow_exception(ex);
+    } );
+
+    //many consumers waiting on and continuing from the same result
+    std::atomic<size_t> nbContinued(0);
+    std::vector<std::thread> waiters;
+    for(size_t i = 0; i < 4; ++i)
+    {
+        result.onComplete([&nbContinued](std::exception_ptr ex)->void {
+            if(!ex) ++nbContinued;
+        } );
+        waiters.emplace_back([result]()->void {
+            auto copy = result;
+            copy.check();
+        } );
+    }
+    for(auto& waiter : waiters)
+    {
+        waiter.join();
+    }
+
+    EXPECT_NO_THROW(result.check());
+    EXPECT_NO_THROW(result.check());
+    EXPECT_EQ(4, nbContinued.load());
+    EXPECT_EQ(5, nbComputed.load());
+
+    //continuations attached after completion are invoked immediately
+    bool lateContinued = false;
+    result.onComplete([&lateContinued](std::exception_ptr ex)->void {
+        lateContinued = !ex;
+    } );
+    EXPECT_TRUE(lateContinued);
+
+    manager->shutdown();
+}
+
+TEST(ASYNC_RESULT_TEST, SHARED_FAILURE)
+{
+    std::promise<bool> promise;
+    AsyncResult result(promise.get_future());
+
+    std::exception_ptr continued;
+    result.onComplete([&continued](std::exception_ptr ex)->void {
+        continued = ex;
+    } );
+
+    promise.set_exception(std::make_exception_ptr(std::runtime_error("failed")));
+    EXPECT_THROW(result.check(), std::runtime_error);
+    EXPECT_THROW(result.check(), std::runtime_error);
+    EXPECT_TRUE(continued != nullptr);
+}
+
+TEST(ASYNC_RESULT_TEST, FUTURE_CONTINUATIONS)
+{
+    //one watcher completes a future backed result for all of its continuations
+    std::promise<bool> promise;
+    AsyncResult result(promise.get_future());
+    std::atomic<size_t> nbContinued(0);
+    for(size_t i = 0; i < 20; ++i)
+    {
+        result.onComplete([&nbContinued](std::exception_ptr ex)->void {
+            if(!ex) ++nbContinued;
+        } );
+    }
+
+    promise.set_value(true);
+    EXPECT_NO_THROW(result.check());
+    EXPECT_EQ(20, nbContinued.load());
+
+    //releasing a result whose future is never ready stops its watcher instead of blocking
+    std::promise<bool> released;
+    std::atomic_bool releasedContinued(false);
+    auto start = std::chrono::steady_clock::now();
+    {
+        AsyncResult releasedResult(released.get_future());
+        releasedResult.onComplete([&releasedContinued](std::exception_ptr ex)->void {
+            releasedContinued = true;
+        } );
+        EXPECT_EQ(tasks::WaitStatus::Timeout, releasedResult.waitFor(std::chrono::milliseconds(5)));
+    }
+    EXPECT_GT(std::chrono::seconds(1), std::chrono::steady_clock::now() - start);
+    released.set_value(true);
+    EXPECT_FALSE(releasedContinued);
+}
+
+TEST(ASYNC_RESULT_TEST, CANCEL_FUTURE)
+{
+    //no task produces a future backed result, so cancelling fails the result itself
+    std::promise<bool> promise;
+    AsyncResult result(promise.get_future());
+    std::exception_ptr continued;
+    result.onComplete([&continued](std::exception_ptr ex)->void {
+        continued = ex;
+    } );
+
+    result.cancel();
+    EXPECT_TRUE(result.isReady());
+    EXPECT_THROW(result.check(), std::runtime_error);
+    EXPECT_TRUE(continued != nullptr);
+
+    //completing the future afterwards is ignored
+    promise.set_value(true);
+    EXPECT_THROW(result.check(), std::runtime_error);
+    EXPECT_EQ(tasks::WaitStatus::Failed, result.waitFor(std::chrono::milliseconds(5)));
+}
+
+TEST(ASYNC_RESULT_TEST, ABANDONED)
+{
+    //a producer dropped without finishing fails its result rather than leaving it pending
+    auto manager(std::make_shared<tasks::AsioManager>(1));
+    AsyncResult result;
+    {
+        auto task = std::make_shared<detail::ParallelCollectTask<size_t>>(manager, 1, 
+            [](std::exception_ptr ex, std::vector<size_t>&&)->void {
+                if(ex) std::rethrow_exception(ex);
+            } );
+        result = task->result();
+        EXPECT_FALSE(result.isReady());
+    }
+    EXPECT_TRUE(result.isReady());
+    EXPECT_THROW(result.check(), std::runtime_error);
+
+    manager->shutdown();
+}
+
+TEST(ASYNC_RESULT_TEST, STACK_MANAGER_CONTINUATION)
+{
+    //a continuation attached from a task on a manager not owned by a shared_ptr is watched by that manager
+    std::promise<bool> promise;
+    AsyncResult result(promise.get_future());
+    std::atomic_bool continued(false);
+    {
+        tasks::AsioManager manager(1);
+        auto task = std::make_shared<ContinueTask>(result, [&continued](std::exception_ptr ex)->void {
+            continued = !ex;
+        } );
+        manager.run(task);
+        ASSERT_TRUE(task->wasSuccessful());
+
+        //checks are rescheduled on the manager until the future is ready
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        promise.set_value(true);
+        auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while(!continued && std::chrono::steady_clock::now() < timeout)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        EXPECT_TRUE(continued);
+
+        manager.shutdown();
+    }
+    EXPECT_NO_THROW(result.check());
+}
+
+TEST(ASYNC_RESULT_TEST, CANCEL_REQUEUED)
+{
+    //a collect task waiting on an outstanding result re-queues itself, so its original task was already performed
+    auto manager(std::make_shared<tasks::AsioManager>(1));
+    std::promise<bool> promise;
+    std::atomic_bool succeeded(false);
+    auto collectTask = std::make_shared<detail::ParallelCollectTask<size_t>>(manager, 1, 
+        [&succeeded](std::exception_ptr ex, std::vector<size_t>&&)->void {
+            if(ex) std::rethrow_exception(ex);
+            succeeded = true;
+        } );
+    auto result = collectTask->result();
+    collectTask->notifyCompletion(0, AsyncResult(promise.get_future()));
+    while(!collectTask->isComplete())
+    {
+        std::this_thread::yield();
+    }
+
+    result.cancel();
+    EXPECT_TRUE(result.isReady());
+    EXPECT_THROW(result.check(), std::runtime_error);
+
+    //the re-queued task finishing afterwards is ignored
+    promise.set_value(true);
+    manager->waitForTasksToComplete();
+    EXPECT_FALSE(succeeded.load());
+    EXPECT_THROW(result.check(), std::runtime_error);
+
+    manager->shutdown();
+}
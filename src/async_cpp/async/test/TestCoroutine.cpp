@@ -0,0 +1,169 @@
+#include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/Coroutine.h"
+#include "async_cpp/async/ParallelFor.h"
+
+#include "async_cpp/tasks/AsioManager.h"
+
+#include <atomic>
+#include <future>
+#include <thread>
+
+#pragma warning(disable:4251)
+#include <gtest/gtest.h>
+
+using namespace async_cpp;
+using namespace async_cpp::async;
+
+//coroutine support requires compiling as C++20 (USE_COROUTINES)
+#if defined(__cpp_impl_coroutine)
+
+Coroutine<size_t> addOne(size_t value)
+{
+    co_return value + 1;
+}
+
+Coroutine<void> fail()
+{
+    throw(std::runtime_error("Coroutine failed"));
+    co_return;
+}
+
+Coroutine<size_t> steps(tasks::ManagerPtr manager)
+{
+    co_await manager->schedule();
+    if(tasks::IManager::current() != manager.get())
+    {
+        throw(std::runtime_error("Not resumed on manager"));
+    }
+
+    auto value = co_await addOne(1);
+
+    size_t sum = 0;
+    auto op = [](size_t index, ParallelFor<size_t>::callback_t cb)->void {
+        cb(index);
+    };
+    co_await ParallelFor<size_t>(manager, op, 5).then([&sum](std::exception_ptr ex, std::vector<size_t>&& results)->void {
+        if(ex) std::rethrow_exception(ex);
+        for(auto val : results) sum += val;
+    } );
+
+    co_return value + sum;
+}
+
+Coroutine<void> catchFailure()
+{
+    try
+    {
+        co_await fail();
+    }
+    catch(std::runtime_error&)
+    {
+        co_return;
+    }
+    throw(std::runtime_error("Failure not propagated"));
+}
+
+Coroutine<void> waitOn(AsyncResult result)
+{
+    co_await result;
+    co_return;
+}
+
+Coroutine<void> startAndWaitOn(std::atomic_bool& started, AsyncResult result)
+{
+    started = true;
+    co_await result;
+    co_return;
+}
+
+TEST(COROUTINE_TEST, BASIC)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(3));
+
+    size_t value = 0;
+    auto result = steps(manager).then(manager, [&value](std::exception_ptr ex, size_t* result)->void {
+        if(ex) std::rethrow_exception(ex);
+        value = *result;
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(12, value);
+
+    manager->shutdown();
+}
+
+TEST(COROUTINE_TEST, EXCEPTION)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(3));
+
+    auto result = fail().then(manager, [](std::exception_ptr ex, void*)->void {
+        if(ex) std::rethrow_exception(ex);
+    } );
+    EXPECT_THROW(result.check(), std::runtime_error);
+
+    auto caught = catchFailure().then(manager, [](std::exception_ptr ex, void*)->void {
+        if(ex) std::rethrow_exception(ex);
+    } );
+    EXPECT_NO_THROW(caught.check());
+
+    manager->shutdown();
+}
+
+TEST(COROUTINE_TEST, CANCEL)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(3));
+
+    //no task owns a coroutine's result, so cancelling fails the result while the coroutine carries on
+    std::promise<bool> promise;
+    std::atomic_bool continued(false);
+    auto result = waitOn(AsyncResult(promise.get_future())).then(manager, [&continued](std::exception_ptr, void*)->void {
+        continued = true;
+    } );
+
+    result.cancel();
+    EXPECT_THROW(result.check(), std::runtime_error);
+
+    promise.set_value(true);
+    manager->waitForTasksToComplete();
+    EXPECT_FALSE(continued.load());
+    EXPECT_THROW(result.check(), std::runtime_error);
+
+    manager->shutdown();
+}
+
+TEST(COROUTINE_TEST, MANAGER_RELEASED)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(1));
+
+    //the manager is gone once the awaited result completes, so the coroutine is resumed as cancelled
+    std::promise<bool> promise;
+    std::atomic_bool started(false);
+    auto result = startAndWaitOn(started, AsyncResult(promise.get_future())).then(manager, 
+        [](std::exception_ptr ex, void*)->void {
+            if(ex) std::rethrow_exception(ex);
+        } );
+    while(!started)
+    {
+        std::this_thread::yield();
+    }
+
+    //shutdown joins the worker, so the coroutine has suspended
+    manager->shutdown();
+    manager.reset();
+
+    promise.set_value(true);
+    EXPECT_THROW(result.check(), std::runtime_error);
+}
+
+TEST(COROUTINE_TEST, SHUTDOWN)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(3));
+    manager->shutdown();
+
+    auto result = addOne(1).then(manager, [](std::exception_ptr ex, size_t*)->void {
+        if(ex) std::rethrow_exception(ex);
+    } );
+    EXPECT_THROW(result.check(), std::runtime_error);
+}
+
+#endif
\ No newline at end of file
@@ -49,4 +49,124 @@ TEST(FILTER_TEST, BASIC)
     EXPECT_NO_THROW(result.check());
     
     manager->shutdown();
-}
\ No newline at end of file
+}
+
+TEST(FILTER_TEST, ORDERED)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+
+    std::vector<size_t> data(100000);
+    std::vector<size_t> expected;
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = (i * 7919) % 1000;
+        if(data[i] % 3 == 0) expected.push_back(data[i]);
+    }
+
+    auto op = [](const size_t& a) -> bool {
+        return a % 3 == 0;
+    };
+
+    std::vector<size_t> filtered;
+    auto result = Filter<size_t>(manager, op, std::move(data), 512).then(
+        [&filtered](std::exception_ptr ex, std::vector<size_t>&& results) -> void {
+            if(ex) std::rethrow_exception(ex);
+            filtered = std::move(results);
+        } );
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, filtered);
+    
+    manager->shutdown();
+}
+
+TEST(FILTER_TEST, KERNEL)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+
+    std::vector<int32_t> data(100003);
+    std::vector<int32_t> expected;
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<int32_t>((i * 7919) % 1000);
+        if(data[i] < 300) expected.push_back(data[i]);
+    }
+
+    auto kernel = Filter<int32_t>::kernel([](const int32_t a) -> bool {
+        return a < 300;
+    } );
+
+    std::vector<int32_t> filtered;
+    auto result = Filter<int32_t>(manager, kernel, std::move(data), 1000).then(
+        [&filtered](std::exception_ptr ex, std::vector<int32_t>&& results)->void
+        {
+            if(ex) std::rethrow_exception(ex);
+            filtered = std::move(results);
+        } );
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, filtered);
+
+    manager->shutdown();
+}
+
+TEST(FILTER_TEST, NO_DEFAULT)
+{
+    struct Value {
+        explicit Value(const int value) : value(value) {}
+        int value;
+    };
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+
+    std::vector<Value> data;
+    std::vector<int> expected;
+    for(int i = 0; i < 10000; ++i)
+    {
+        data.emplace_back((i * 7919) % 1000);
+        if(data.back().value % 4 == 0) expected.push_back(data.back().value);
+    }
+
+    auto op = [](const Value& a) -> bool {
+        return a.value % 4 == 0;
+    };
+
+    std::vector<int> filtered;
+    auto result = Filter<Value>(manager, op, std::move(data), 100).then(
+        [&filtered](std::exception_ptr ex, std::vector<Value>&& results) -> void {
+            if(ex) std::rethrow_exception(ex);
+            for(auto& result : results)
+            {
+                filtered.push_back(result.value);
+            }
+        } );
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, filtered);
+
+    manager->shutdown();
+}
+
+TEST(FILTER_TEST, BOOL)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+
+    std::vector<bool> data(10000);
+    size_t expected = 0;
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = (i % 3 == 0);
+        if(data[i]) ++expected;
+    }
+
+    auto op = [](const bool& a) -> bool {
+        return a;
+    };
+
+    std::vector<bool> filtered;
+    auto result = Filter<bool>(manager, op, std::move(data), 100).then(
+        [&filtered](std::exception_ptr ex, std::vector<bool>&& results) -> void {
+            if(ex) std::rethrow_exception(ex);
+            filtered = std::move(results);
+        } );
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(std::vector<bool>(expected, true), filtered);
+
+    manager->shutdown();
+}
@@ -47,4 +47,168 @@ TEST(MAP_TEST, BASIC)
     EXPECT_NO_THROW(result.check());
 
     manager->shutdown();
-}
\ No newline at end of file
+}
+
+TEST(MAP_TEST, IN_PLACE)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+
+    std::vector<size_t> data(100000);
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = i;
+    }
+    auto original = data.data();
+
+    auto mapOp = [](const size_t& a) -> size_t {
+        return a * 3;
+    };
+
+    std::vector<size_t> mapped;
+    auto result = Map<size_t, size_t>(manager, mapOp, std::move(data), 1000).then(
+        [&mapped](std::exception_ptr ex, std::vector<size_t>&& results)->void
+        {
+            if(ex) std::rethrow_exception(ex);
+            mapped = std::move(results);
+        } );
+    ASSERT_NO_THROW(result.check());
+
+    //same buffer is handed back, results were written over data
+    EXPECT_EQ(original, mapped.data());
+    ASSERT_EQ(100000, mapped.size());
+    for(size_t i = 0; i < mapped.size(); ++i)
+    {
+        ASSERT_EQ(i * 3, mapped[i]);
+    }
+
+    manager->shutdown();
+}
+
+TEST(MAP_TEST, OUTPUT)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+
+    std::vector<int> data(50000);
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<int>(i);
+    }
+    std::vector<double> output;
+
+    auto mapOp = [](const int& a) -> double {
+        return a / 2.0;
+    };
+
+    auto result = Map<int, double>(manager, mapOp, data, output).then(
+        [](std::exception_ptr ex, std::vector<double>&& results)->void
+        {
+            if(ex) std::rethrow_exception(ex);
+            if(!results.empty()) throw(std::runtime_error("Results should be in output"));
+        } );
+    ASSERT_NO_THROW(result.check());
+
+    ASSERT_EQ(data.size(), output.size());
+    for(size_t i = 0; i < output.size(); ++i)
+    {
+        ASSERT_EQ(data[i] / 2.0, output[i]);
+    }
+
+    manager->shutdown();
+}
+
+TEST(MAP_TEST, KERNEL)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+
+    std::vector<float> data(100003);
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<float>(i);
+    }
+
+    auto kernel = Map<float, float>::kernel([](const float a) -> float {
+        return a * 2.0f + 1.0f;
+    } );
+
+    std::vector<float> mapped;
+    auto result = Map<float, float>(manager, kernel, std::move(data), 1000).then(
+        [&mapped](std::exception_ptr ex, std::vector<float>&& results)->void
+        {
+            if(ex) std::rethrow_exception(ex);
+            mapped = std::move(results);
+        } );
+    ASSERT_NO_THROW(result.check());
+
+    ASSERT_EQ(100003, mapped.size());
+    for(size_t i = 0; i < mapped.size(); ++i)
+    {
+        ASSERT_EQ(static_cast<float>(i) * 2.0f + 1.0f, mapped[i]);
+    }
+
+    manager->shutdown();
+}
+
+TEST(MAP_TEST, BOOL)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+
+    std::vector<int> data(10000);
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<int>(i);
+    }
+
+    auto isEven = [](const int& a) -> bool {
+        return a % 2 == 0;
+    };
+
+    std::vector<bool> output;
+    auto outputResult = Map<int, bool>(manager, isEven, data, output, 100).then(
+        [](std::exception_ptr ex, std::vector<bool>&&)->void
+        {
+            if(ex) std::rethrow_exception(ex);
+        } );
+    ASSERT_NO_THROW(outputResult.check());
+
+    ASSERT_EQ(data.size(), output.size());
+    for(size_t i = 0; i < output.size(); ++i)
+    {
+        ASSERT_EQ(i % 2 == 0, output[i]);
+    }
+
+    auto toInt = [](const bool& a) -> int {
+        return a ? 1 : 0;
+    };
+
+    std::vector<int> mapped;
+    auto ownedResult = Map<bool, int>(manager, toInt, std::move(output), 100).then(
+        [&mapped](std::exception_ptr ex, std::vector<int>&& results)->void
+        {
+            if(ex) std::rethrow_exception(ex);
+            mapped = std::move(results);
+        } );
+    ASSERT_NO_THROW(ownedResult.check());
+
+    ASSERT_EQ(data.size(), mapped.size());
+    for(size_t i = 0; i < mapped.size(); ++i)
+    {
+        ASSERT_EQ(i % 2 == 0 ? 1 : 0, mapped[i]);
+    }
+
+    //chunks which do not divide the data evenly are copied into the output in order
+    std::vector<bool> unevenOutput;
+    auto unevenResult = Map<int, bool>(manager, isEven, data, unevenOutput, 97).then(
+        [](std::exception_ptr ex, std::vector<bool>&&)->void
+        {
+            if(ex) std::rethrow_exception(ex);
+        } );
+    ASSERT_NO_THROW(unevenResult.check());
+
+    ASSERT_EQ(data.size(), unevenOutput.size());
+    for(size_t i = 0; i < unevenOutput.size(); ++i)
+    {
+        ASSERT_EQ(i % 2 == 0, unevenOutput[i]);
+    }
+
+    manager->shutdown();
+}
@@ -0,0 +1,175 @@
+#include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/ParallelAllOf.h"
+#include "async_cpp/async/ParallelAnyOf.h"
+#include "async_cpp/async/ParallelFind.h"
+
+#include "async_cpp/tasks/AsioManager.h"
+
+#include <atomic>
+#include <numeric>
+
+#pragma warning(disable:4251)
+#include <gtest/gtest.h>
+
+using namespace async_cpp;
+using namespace async_cpp::async;
+
+TEST(PARALLEL_FIND_TEST, FIRST)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<size_t> data(100000);
+    std::iota(data.begin(), data.end(), 0);
+
+    //several chunks hold matches, only the lowest may be reported
+    size_t index = 0;
+    ParallelFind<size_t> find(manager, [](const size_t& value)->bool { return value > 0 && 0 == value % 4321; }, 
+        data.begin(), data.end(), 100);
+    auto result = find.then([&index](std::exception_ptr ex, size_t* value)->void {
+        if(ex) std::rethrow_exception(ex);
+        index = *value;
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(4321, index);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_FIND_TEST, NOT_FOUND)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<size_t> data(1000, 1);
+
+    size_t index = 0;
+    ParallelFind<size_t> find(manager, [](const size_t& value)->bool { return 2 == value; }, 
+        data.begin(), data.end(), 10);
+    auto result = find.then([&index](std::exception_ptr ex, size_t* value)->void {
+        if(ex) std::rethrow_exception(ex);
+        index = *value;
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(ParallelFind<size_t>::NOT_FOUND, index);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_FIND_TEST, ANY_OF)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<int> data(10000, 1);
+    data[7777] = -1;
+
+    bool anyNegative = false;
+    ParallelAnyOf<int> anyOf(manager, [](const int& value)->bool { return value < 0; }, 
+        data.begin(), data.end(), 50);
+    auto result = anyOf.then([&anyNegative](std::exception_ptr ex, bool* value)->void {
+        if(ex) std::rethrow_exception(ex);
+        anyNegative = *value;
+    } );
+    ASSERT_NO_THROW(result.check());
+    EXPECT_TRUE(anyNegative);
+
+    bool anyZero = true;
+    ParallelAnyOf<int> noneOf(manager, [](const int& value)->bool { return 0 == value; }, 
+        data.data(), data.data() + data.size(), 50);
+    result = noneOf.then([&anyZero](std::exception_ptr ex, bool* value)->void {
+        if(ex) std::rethrow_exception(ex);
+        anyZero = *value;
+    } );
+    ASSERT_NO_THROW(result.check());
+    EXPECT_FALSE(anyZero);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_FIND_TEST, ALL_OF)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<int> data(10000, 1);
+
+    bool allPositive = false;
+    ParallelAllOf<int> allOf(manager, [](const int& value)->bool { return value > 0; }, 
+        data.begin(), data.end(), 50);
+    auto result = allOf.then([&allPositive](std::exception_ptr ex, bool* value)->void {
+        if(ex) std::rethrow_exception(ex);
+        allPositive = *value;
+    } );
+    ASSERT_NO_THROW(result.check());
+    EXPECT_TRUE(allPositive);
+
+    data[123] = 0;
+    ParallelAllOf<int> notAllOf(manager, [](const int& value)->bool { return value > 0; }, 
+        data.begin(), data.end(), 50);
+    result = notAllOf.then([&allPositive](std::exception_ptr ex, bool* value)->void {
+        if(ex) std::rethrow_exception(ex);
+        allPositive = *value;
+    } );
+    ASSERT_NO_THROW(result.check());
+    EXPECT_FALSE(allPositive);
+
+    //an empty range holds no failing item
+    bool allEmpty = false;
+    ParallelAllOf<int> emptyOf(manager, [](const int& value)->bool { return value > 0; }, 
+        data.end(), data.end());
+    result = emptyOf.then([&allEmpty](std::exception_ptr ex, bool* value)->void {
+        if(ex) std::rethrow_exception(ex);
+        allEmpty = *value;
+    } );
+    ASSERT_NO_THROW(result.check());
+    EXPECT_TRUE(allEmpty);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_FIND_TEST, SHORT_CIRCUIT)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<int> data(1000000, 1);
+    data[10] = -1;
+
+    //a match near the start stops the search long before every item is evaluated
+    std::atomic<size_t> nbEvaluated(0);
+    size_t index = 0;
+    ParallelFind<int> find(manager, [&nbEvaluated](const int& value)->bool { 
+            ++nbEvaluated;
+            return value < 0; 
+        }, data.begin(), data.end(), 100);
+    auto result = find.then([&index](std::exception_ptr ex, size_t* value)->void {
+        if(ex) std::rethrow_exception(ex);
+        index = *value;
+    } );
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(10, index);
+    EXPECT_GT(data.size() / 10, nbEvaluated.load());
+
+    nbEvaluated = 0;
+    bool anyNegative = false;
+    ParallelAnyOf<int> anyOf(manager, [&nbEvaluated](const int& value)->bool { 
+            ++nbEvaluated;
+            return value < 0; 
+        }, data.begin(), data.end(), 100);
+    result = anyOf.then([&anyNegative](std::exception_ptr ex, bool* value)->void {
+        if(ex) std::rethrow_exception(ex);
+        anyNegative = *value;
+    } );
+    ASSERT_NO_THROW(result.check());
+    EXPECT_TRUE(anyNegative);
+    EXPECT_GT(data.size() / 10, nbEvaluated.load());
+
+    nbEvaluated = 0;
+    bool allPositive = true;
+    ParallelAllOf<int> allOf(manager, [&nbEvaluated](const int& value)->bool { 
+            ++nbEvaluated;
+            return value > 0; 
+        }, data.begin(), data.end(), 100);
+    result = allOf.then([&allPositive](std::exception_ptr ex, bool* value)->void {
+        if(ex) std::rethrow_exception(ex);
+        allPositive = *value;
+    } );
+    ASSERT_NO_THROW(result.check());
+    EXPECT_FALSE(allPositive);
+    EXPECT_GT(data.size() / 10, nbEvaluated.load());
+
+    manager->shutdown();
+}
@@ -0,0 +1,96 @@
+#include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/ParallelFlatMap.h"
+
+#include "async_cpp/tasks/AsioManager.h"
+
+#include <sstream>
+#include <string>
+
+#pragma warning(disable:4251)
+#include <gtest/gtest.h>
+
+using namespace async_cpp;
+using namespace async_cpp::async;
+
+TEST(PARALLEL_FLAT_MAP_TEST, EXPAND)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<size_t> data(10000);
+    std::vector<size_t> expected;
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = i;
+        //each value expands to value % 4 copies, so some items produce nothing
+        expected.insert(expected.end(), i % 4, i);
+    }
+
+    auto op = [](const size_t& value, std::vector<size_t>& results)->void {
+        results.insert(results.end(), value % 4, value);
+    };
+
+    std::vector<size_t> flattened;
+    auto result = ParallelFlatMap<size_t, size_t>(manager, op, std::move(data), 100).then(
+        [&flattened](std::exception_ptr ex, std::vector<size_t>&& results)->void
+        {
+            if(ex) std::rethrow_exception(ex);
+            flattened = std::move(results);
+        } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, flattened);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_FLAT_MAP_TEST, TOKENISE)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<std::string> data;
+    data.emplace_back("the quick brown");
+    data.emplace_back("");
+    data.emplace_back("fox jumps");
+
+    auto op = [](const std::string& line, std::vector<std::string>& words)->void {
+        std::istringstream stream(line);
+        std::string word;
+        while(stream >> word)
+        {
+            words.push_back(word);
+        }
+    };
+
+    std::vector<std::string> words;
+    auto result = ParallelFlatMap<std::string, std::string>(manager, op, std::move(data), 1).then(
+        [&words](std::exception_ptr ex, std::vector<std::string>&& results)->void
+        {
+            if(ex) std::rethrow_exception(ex);
+            words = std::move(results);
+        } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(std::vector<std::string>({"the", "quick", "brown", "fox", "jumps"}), words);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_FLAT_MAP_TEST, FAILURE)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<int> data(1000, 1);
+    data[500] = -1;
+
+    auto op = [](const int& value, std::vector<int>& results)->void {
+        if(value < 0) throw(std::runtime_error("Negative value"));
+        results.push_back(value);
+    };
+
+    auto result = ParallelFlatMap<int, int>(manager, op, std::move(data), 10).then(
+        [](std::exception_ptr ex, std::vector<int>&&)->void
+        {
+            if(ex) std::rethrow_exception(ex);
+        } );
+
+    ASSERT_THROW(result.check(), std::runtime_error);
+
+    manager->shutdown();
+}
@@ -1,8 +1,10 @@
 #include "async_cpp/async/AsyncResult.h"
 #include "async_cpp/async/ParallelFor.h"
+#include "async_cpp/async/ParallelForND.h"
 
 #include "async_cpp/tasks/AsioManager.h"
 
+#include <algorithm>
 #include <chrono>
 
 #pragma warning(disable:4251)
@@ -53,4 +55,250 @@ TEST(PARALLEL_FOR_TEST, BASIC)
     ASSERT_NO_THROW(result.check());
 
     manager->shutdown();
-}
\ No newline at end of file
+}
+
+TEST(PARALLEL_FOR_TEST, RANGE)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    const size_t nbTimes = 100000;
+    const size_t grainSize = 1000;
+    std::vector<size_t> values(nbTimes, 0);
+
+    auto func = [&values, grainSize](const size_t begin, const size_t end, ParallelFor<size_t>::callback_t cb)->void {
+        if(end - begin > grainSize)
+        {
+            throw(std::runtime_error("Chunk larger than grain size"));
+        }
+        for(size_t i = begin; i < end; ++i)
+        {
+            values[i] = i * 2;
+        }
+        cb(end - begin);
+    };
+
+    ParallelFor<size_t> parallel(manager, func, nbTimes, grainSize);
+    auto result = parallel.then([&values, nbTimes](std::exception_ptr ex, std::vector<size_t>&& results)->void {
+        if(ex) std::rethrow_exception(ex);
+
+        size_t total = 0;
+        for(auto size : results)
+        {
+            total += size;
+        }
+        if(total != nbTimes)
+        {
+            throw(std::runtime_error("Callback invoked before all chunks finished"));
+        }
+
+        for(size_t i = 0; i < values.size(); ++i)
+        {
+            if(values[i] != i * 2)
+            {
+                throw(std::runtime_error("Index not visited"));
+            }
+        }
+    } );
+
+    ASSERT_NO_THROW(result.check());
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_FOR_TEST, RANGE_FAILURE)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+
+    auto func = [](const size_t begin, const size_t end, ParallelFor<size_t>::callback_t cb)->void {
+        if(begin == 0)
+        {
+            cb(std::make_exception_ptr(std::runtime_error("Failed chunk")));
+        }
+        else
+        {
+            cb(end - begin);
+        }
+    };
+
+    ParallelFor<size_t> parallel(manager, func, 1000, 10);
+    auto result = parallel.then([](std::exception_ptr ex, std::vector<size_t>&&)->void {
+        if(ex) std::rethrow_exception(ex);
+    } );
+
+    ASSERT_THROW(result.check(), std::runtime_error);
+    ASSERT_THROW(ParallelFor<size_t>(manager, func, 1000, 0), std::invalid_argument);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_FOR_TEST, TILES_2D)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    const size_t rows = 1000;
+    const size_t columns = 700;
+    std::vector<size_t> values(rows * columns, 0);
+
+    auto func = [&values, columns](const ParallelFor2D<size_t>::tile_t& tile, ParallelFor2D<size_t>::callback_t cb)->void {
+        if(tile[0].size() > 64 || tile[1].size() > 32)
+        {
+            throw(std::runtime_error("Tile larger than tile size"));
+        }
+        for(size_t row = tile[0].begin(); row < tile[0].end(); ++row)
+        {
+            for(size_t column = tile[1].begin(); column < tile[1].end(); ++column)
+            {
+                values[row * columns + column] += row * columns + column;
+            }
+        }
+        cb(tile[0].begin() * columns + tile[1].begin());
+    };
+
+    ParallelFor2D<size_t> parallel(manager, func, {{rows, columns}}, {{64, 32}});
+    auto result = parallel.then([&values](std::exception_ptr ex, std::vector<size_t>&& results)->void {
+        if(ex) std::rethrow_exception(ex);
+
+        if(!std::is_sorted(results.begin(), results.end()))
+        {
+            throw(std::runtime_error("Results not in row major order"));
+        }
+        for(size_t i = 0; i < values.size(); ++i)
+        {
+            if(values[i] != i)
+            {
+                throw(std::runtime_error("Index not visited exactly once"));
+            }
+        }
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    ASSERT_THROW(ParallelFor2D<size_t>(manager, func, {{rows, 0}}, {{64, 32}}), std::invalid_argument);
+    ASSERT_THROW(ParallelFor2D<size_t>(manager, func, {{rows, columns}}, {{0, 32}}), std::invalid_argument);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_FOR_TEST, TILES_3D_MORTON)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    const std::array<size_t, 3> extents = {{30, 40, 50}};
+    std::vector<size_t> values(extents[0] * extents[1] * extents[2], 0);
+
+    auto func = [&values, extents](const ParallelFor3D<size_t>::tile_t& tile, ParallelFor3D<size_t>::callback_t cb)->void {
+        for(size_t x = tile[0].begin(); x < tile[0].end(); ++x)
+        {
+            for(size_t y = tile[1].begin(); y < tile[1].end(); ++y)
+            {
+                for(size_t z = tile[2].begin(); z < tile[2].end(); ++z)
+                {
+                    ++values[(x * extents[1] + y) * extents[2] + z];
+                }
+            }
+        }
+        cb(tile.size());
+    };
+
+    ParallelFor3D<size_t> parallel(manager, func, extents, {{8, 8, 8}}, TileOrder::Morton);
+    auto result = parallel.then([&values](std::exception_ptr ex, std::vector<size_t>&& results)->void {
+        if(ex) std::rethrow_exception(ex);
+
+        //4 x 5 x 7 tiles
+        if(results.size() != 140)
+        {
+            throw(std::runtime_error("Unexpected number of tiles"));
+        }
+        if(std::count(values.begin(), values.end(), 1) != static_cast<std::ptrdiff_t>(values.size()))
+        {
+            throw(std::runtime_error("Index not visited exactly once"));
+        }
+    } );
+
+    ASSERT_NO_THROW(result.check());
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_FOR_TEST, NESTED)
+{
+    //outer chunks wait on inner parallel loops, which run depth first on the waiting workers
+    auto manager(std::make_shared<tasks::AsioManager>(2));
+    const size_t nbOuter = 16;
+    const size_t nbInner = 1000;
+    std::vector<size_t> values(nbOuter * nbInner, 0);
+
+    auto outerFunc = [manager, &values, nbInner](const size_t begin, const size_t end, ParallelFor<size_t>::callback_t cb)->void {
+        for(size_t outer = begin; outer < end; ++outer)
+        {
+            auto innerFunc = [&values, outer, nbInner](const size_t innerBegin, const size_t innerEnd, ParallelFor<size_t>::callback_t innerCb)->void {
+                for(size_t inner = innerBegin; inner < innerEnd; ++inner)
+                {
+                    ++values[outer * nbInner + inner];
+                }
+                innerCb(innerEnd - innerBegin);
+            };
+            ParallelFor<size_t> inner(manager, innerFunc, nbInner, 10);
+            inner.then([](std::exception_ptr ex, std::vector<size_t>&&)->void {
+                if(ex) std::rethrow_exception(ex);
+            } ).check();
+        }
+        cb(end - begin);
+    };
+
+    ParallelFor<size_t> outer(manager, outerFunc, nbOuter, 1);
+    auto result = outer.then([&values](std::exception_ptr ex, std::vector<size_t>&&)->void {
+        if(ex) std::rethrow_exception(ex);
+        if(std::count(values.begin(), values.end(), 1) != static_cast<std::ptrdiff_t>(values.size()))
+        {
+            throw(std::runtime_error("Index not visited exactly once"));
+        }
+    } );
+
+    ASSERT_NO_THROW(result.check());
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_FOR_TEST, ADAPTIVE)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    const size_t nbTimes = 100000;
+    std::vector<size_t> values(nbTimes, 0);
+
+    auto func = [&values](const size_t begin, const size_t end, ParallelFor<size_t>::callback_t cb)->void {
+        for(size_t i = begin; i < end; ++i)
+        {
+            values[i] = i * 2;
+        }
+        cb(end - begin);
+    };
+
+    ParallelFor<size_t> parallel(manager, func, nbTimes, std::chrono::microseconds(50));
+    auto result = parallel.then([&values, nbTimes](std::exception_ptr ex, std::vector<size_t>&& results)->void {
+        if(ex) std::rethrow_exception(ex);
+
+        size_t total = 0;
+        for(auto size : results)
+        {
+            total += size;
+        }
+        if(total != nbTimes)
+        {
+            throw(std::runtime_error("Callback invoked before all chunks finished"));
+        }
+        //cheap iterations should grow chunks well past a single index
+        if(results.size() >= nbTimes / 10)
+        {
+            throw(std::runtime_error("Chunks did not grow"));
+        }
+
+        for(size_t i = 0; i < values.size(); ++i)
+        {
+            if(values[i] != i * 2)
+            {
+                throw(std::runtime_error("Index not visited"));
+            }
+        }
+    } );
+
+    ASSERT_NO_THROW(result.check());
+
+    manager->shutdown();
+}
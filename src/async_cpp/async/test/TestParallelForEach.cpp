@@ -4,6 +4,7 @@
 #include "async_cpp/tasks/AsioManager.h"
 
 #include <chrono>
+#include <deque>
 
 #pragma warning(disable:4251)
 #include <gtest/gtest.h>
@@ -49,4 +50,124 @@ TEST(PARALLEL_FOREACH_TEST, BASIC)
     ASSERT_GE(totalDur, maxDur);
 
     manager->shutdown();
-}
\ No newline at end of file
+}
+
+TEST(PARALLEL_FOREACH_TEST, ITERATORS)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::deque<size_t> data;
+    for(size_t i = 0; i < 10000; ++i)
+    {
+        data.push_back(i);
+    }
+
+    auto func = [](size_t& value, ParallelForEach<size_t>::callback_t cb)->void {
+        value *= 2;
+        cb(value + 1);
+    };
+
+    ParallelForEach<size_t> parallel(manager, func, data.begin(), data.end(), 100);
+    auto result = parallel.then([](std::exception_ptr ex, std::vector<size_t>&& results)->void {
+        if(ex) std::rethrow_exception(ex);
+
+        for(size_t i = 0; i < results.size(); ++i)
+        {
+            if(results[i] != i * 2 + 1) throw(std::runtime_error("Result out of order"));
+        }
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        ASSERT_EQ(i * 2, data[i]);
+    }
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_FOREACH_TEST, SPAN)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::unique_ptr<int[]> data(new int[5000]);
+    for(int i = 0; i < 5000; ++i)
+    {
+        data[i] = i;
+    }
+
+    auto func = [](int& value, ParallelForEach<int, bool>::callback_t cb)->void {
+        value = -value;
+        cb(AsyncResult());
+    };
+
+    ParallelForEach<int, bool> parallel(manager, func, data.get(), 5000);
+    auto result = parallel.then([](std::exception_ptr ex, std::vector<bool>&& results)->void {
+        if(ex) std::rethrow_exception(ex);
+        if(!results.empty()) throw(std::runtime_error("No results expected"));
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    for(int i = 0; i < 5000; ++i)
+    {
+        ASSERT_EQ(-i, data[i]);
+    }
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_FOREACH_TEST, ADAPTIVE)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<int> data(5000);
+    for(int i = 0; i < 5000; ++i)
+    {
+        data[i] = i;
+    }
+
+    auto func = [](int& value, ParallelForEach<int, bool>::callback_t cb)->void {
+        value = -value;
+        cb(AsyncResult());
+    };
+
+    ParallelForEach<int, bool> parallel(manager, func, data.begin(), data.end(), std::chrono::microseconds(50));
+    auto result = parallel.then([](std::exception_ptr ex, std::vector<bool>&& results)->void {
+        if(ex) std::rethrow_exception(ex);
+        if(!results.empty()) throw(std::runtime_error("No results expected"));
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    for(int i = 0; i < 5000; ++i)
+    {
+        ASSERT_EQ(-i, data[i]);
+    }
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_FOREACH_TEST, SPAN_FAILURE)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<int> data(5000);
+    for(int i = 0; i < 5000; ++i)
+    {
+        data[i] = i;
+    }
+
+    //a failed item fails the chunk it was gathered in, and so the whole operation
+    auto func = [](int& value, ParallelForEach<int>::callback_t cb)->void {
+        if(2500 == value)
+        {
+            cb(std::make_exception_ptr(std::runtime_error("Item failed")));
+            return;
+        }
+        cb(value);
+    };
+
+    ParallelForEach<int> parallel(manager, func, data.data(), data.size(), 100);
+    auto result = parallel.then([](std::exception_ptr ex, std::vector<int>&&)->void {
+        if(ex) std::rethrow_exception(ex);
+    } );
+
+    EXPECT_THROW(result.check(), std::runtime_error);
+
+    manager->shutdown();
+}
@@ -0,0 +1,80 @@
+#include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/ParallelGroupBy.h"
+
+#include "async_cpp/tasks/AsioManager.h"
+
+#include <string>
+
+#pragma warning(disable:4251)
+#include <gtest/gtest.h>
+
+using namespace async_cpp;
+using namespace async_cpp::async;
+
+TEST(PARALLEL_GROUP_BY_TEST, VECTORS)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<size_t> data(100000);
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = i;
+    }
+
+    auto keyOp = [](const size_t& value)->size_t { return value % 37; };
+
+    ParallelGroupBy<size_t, size_t>::result_t groups;
+    ParallelGroupBy<size_t, size_t> groupBy(manager, keyOp, std::move(data), 500);
+    auto result = groupBy.then([&groups](std::exception_ptr ex, ParallelGroupBy<size_t, size_t>::result_t* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        groups = std::move(*values);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    ASSERT_EQ(37, groups.size());
+    size_t total = 0;
+    for(auto& kv : groups)
+    {
+        total += kv.second.size();
+        for(size_t i = 0; i < kv.second.size(); ++i)
+        {
+            //each group keeps data in its original order
+            ASSERT_EQ(kv.first + i * 37, kv.second[i]);
+        }
+    }
+    EXPECT_EQ(100000, total);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_GROUP_BY_TEST, AGGREGATE)
+{
+    typedef std::pair<std::string, int> data_t;
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<data_t> data;
+    for(int i = 0; i < 30000; ++i)
+    {
+        data.push_back(data_t(std::to_string(i % 100), i));
+    }
+
+    auto keyOp = [](const data_t& value)->std::string { return value.first; };
+    auto accumulateOp = [](long long& sum, data_t&& value)->void { sum += value.second; };
+    auto combineOp = [](long long& sum, long long&& later)->void { sum += later; };
+
+    ParallelGroupBy<data_t, std::string, long long>::result_t sums;
+    ParallelGroupBy<data_t, std::string, long long> groupBy(manager, keyOp, 0, accumulateOp, combineOp, std::move(data));
+    auto result = groupBy.then([&sums](std::exception_ptr ex, ParallelGroupBy<data_t, std::string, long long>::result_t* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        sums = std::move(*values);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    ASSERT_EQ(100, sums.size());
+    for(int key = 0; key < 100; ++key)
+    {
+        //key, key + 100, ... key + 29900
+        long long expected = 300LL * key + 100LL * (299LL * 300 / 2);
+        EXPECT_EQ(expected, sums[std::to_string(key)]);
+    }
+
+    manager->shutdown();
+}
\ No newline at end of file
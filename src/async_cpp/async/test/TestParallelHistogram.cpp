@@ -0,0 +1,93 @@
+#include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/ParallelCountBy.h"
+#include "async_cpp/async/ParallelHistogram.h"
+
+#include "async_cpp/tasks/AsioManager.h"
+
+#include <limits>
+#include <string>
+
+#pragma warning(disable:4251)
+#include <gtest/gtest.h>
+
+using namespace async_cpp;
+using namespace async_cpp::async;
+
+TEST(PARALLEL_HISTOGRAM_TEST, BIN_OP)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<size_t> data(100000);
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = i;
+    }
+
+    //the last bin is outside of the histogram and not counted
+    std::vector<size_t> bins;
+    ParallelHistogram<size_t> histogram(manager, [](const size_t& value)->size_t { return value % 11; }, 10, 
+        std::move(data), 1000);
+    auto result = histogram.then([&bins](std::exception_ptr ex, std::vector<size_t>* counts)->void {
+        if(ex) std::rethrow_exception(ex);
+        bins = std::move(*counts);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(std::vector<size_t>(10, 100000 / 11 + 1), bins);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_HISTOGRAM_TEST, NUMERIC)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<double> data;
+    for(size_t i = 0; i < 1000; ++i)
+    {
+        data.push_back(static_cast<double>(i) / 100.0);
+    }
+    data.push_back(-1.0);
+    data.push_back(20.0);
+    data.push_back(std::numeric_limits<double>::quiet_NaN());
+
+    std::vector<size_t> bins;
+    ParallelHistogram<double> histogram(manager, 0.0, 10.0, 5, std::move(data), 64);
+    auto result = histogram.then([&bins](std::exception_ptr ex, std::vector<size_t>* counts)->void {
+        if(ex) std::rethrow_exception(ex);
+        bins = std::move(*counts);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(std::vector<size_t>(5, 200), bins);
+
+    EXPECT_THROW(ParallelHistogram<double>(manager, 1.0, 1.0, 5, std::vector<double>()), std::invalid_argument);
+    EXPECT_THROW(ParallelHistogram<double>(manager, 0.0, 1.0, 0, std::vector<double>()), std::invalid_argument);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_COUNT_BY_TEST, COUNT)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<std::string> data;
+    for(size_t i = 0; i < 10000; ++i)
+    {
+        data.push_back(std::to_string(i % 7));
+    }
+
+    std::unordered_map<std::string, size_t> counts;
+    ParallelCountBy<std::string, std::string> countBy(manager, [](const std::string& value)->std::string { return value; }, 
+        std::move(data), 100);
+    auto result = countBy.then([&counts](std::exception_ptr ex, std::unordered_map<std::string, size_t>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        counts = std::move(*values);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    ASSERT_EQ(7, counts.size());
+    for(size_t i = 0; i < 7; ++i)
+    {
+        EXPECT_EQ(10000 / 7 + (i < 10000 % 7 ? 1 : 0), counts[std::to_string(i)]);
+    }
+
+    manager->shutdown();
+}
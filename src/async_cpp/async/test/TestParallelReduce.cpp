@@ -0,0 +1,159 @@
+#include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/ParallelReduce.h"
+
+#include "async_cpp/tasks/AsioManager.h"
+
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <string>
+
+#pragma warning(disable:4251)
+#include <gtest/gtest.h>
+
+using namespace async_cpp;
+using namespace async_cpp::async;
+
+TEST(PARALLEL_REDUCE_TEST, SUM)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<size_t> data(100000);
+    std::iota(data.begin(), data.end(), 1);
+    const size_t expected = data.size() * (data.size() + 1) / 2;
+
+    auto mapOp = [](const size_t& value)->size_t { return value; };
+    auto combineOp = [](size_t&& left, size_t&& right)->size_t { return left + right; };
+
+    size_t sum = 0;
+    ParallelReduce<size_t> reduce(manager, 0, mapOp, combineOp, std::move(data), 100);
+    auto result = reduce.then([&sum](std::exception_ptr ex, size_t* value)->void {
+        if(ex) std::rethrow_exception(ex);
+        sum = *value;
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, sum);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_REDUCE_TEST, ORDERED)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<size_t> data(1000);
+    std::iota(data.begin(), data.end(), 0);
+    std::string expected;
+    for(auto value : data)
+    {
+        expected += std::to_string(value) + ",";
+    }
+
+    auto mapOp = [](const size_t& value)->std::string { return std::to_string(value) + ","; };
+    auto combineOp = [](std::string&& left, std::string&& right)->std::string { return left + right; };
+
+    std::string joined;
+    ParallelReduce<size_t, std::string> reduce(manager, std::string(), mapOp, combineOp, std::move(data), 7);
+    auto result = reduce.then([&joined](std::exception_ptr ex, std::string* value)->void {
+        if(ex) std::rethrow_exception(ex);
+        joined = std::move(*value);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, joined);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_REDUCE_TEST, EMPTY)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+
+    auto mapOp = [](const int& value)->int { return value; };
+    auto combineOp = [](int&& left, int&& right)->int { return left * right; };
+
+    int product = 0;
+    ParallelReduce<int> reduce(manager, 1, mapOp, combineOp, std::vector<int>());
+    auto result = reduce.then([&product](std::exception_ptr ex, int* value)->void {
+        if(ex) std::rethrow_exception(ex);
+        product = *value;
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(1, product);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_REDUCE_TEST, FAILURE)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<int> data(1000, 1);
+    data[500] = -1;
+
+    auto mapOp = [](const int& value)->int { 
+        if(value < 0) throw(std::runtime_error("Negative value"));
+        return value; 
+    };
+    auto combineOp = [](int&& left, int&& right)->int { return left + right; };
+
+    ParallelReduce<int> reduce(manager, 0, mapOp, combineOp, std::move(data), 10);
+    auto result = reduce.then([](std::exception_ptr ex, int*)->void {
+        if(ex) std::rethrow_exception(ex);
+    } );
+
+    ASSERT_THROW(result.check(), std::runtime_error);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_REDUCE_TEST, DETERMINISTIC)
+{
+    //values of very different magnitudes, so any change in combine order changes the floating point sum
+    std::vector<double> data(100000);
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = (0 == i % 3) ? 1.0e12 / (i + 1) : 1.0 / (i + 1);
+    }
+
+    auto mapOp = [](const double& value)->double { return value; };
+    auto combineOp = [](double&& left, double&& right)->double { return left + right; };
+
+    std::vector<double> sums;
+    for(size_t nbThreads : {1, 3, 8})
+    {
+        auto manager(std::make_shared<tasks::AsioManager>(nbThreads));
+        auto copy = data;
+        ParallelReduce<double> reduce(manager, 0.0, mapOp, combineOp, std::move(copy), 0, ReduceMode::Deterministic);
+        auto result = reduce.then([&sums](std::exception_ptr ex, double* value)->void {
+            if(ex) std::rethrow_exception(ex);
+            sums.push_back(*value);
+        } );
+
+        ASSERT_NO_THROW(result.check());
+        manager->shutdown();
+    }
+
+    //chunking depends on the data size alone, 64 chunks of the data halved until no larger than the grain size
+    const size_t grainSize = 1562;
+    EXPECT_EQ(grainSize, detail::BlockedRange::deterministicGrainSize(data.size()));
+    std::function<double(size_t, size_t)> reduceTree = [&](const size_t begin, const size_t end)->double {
+        if(end - begin <= grainSize)
+        {
+            auto partial = 0.0;
+            for(size_t i = begin; i < end; ++i)
+            {
+                partial = partial + data[i];
+            }
+            return partial;
+        }
+        auto middle = begin + (end - begin) / 2;
+        auto left = reduceTree(begin, middle);
+        return left + reduceTree(middle, end);
+    };
+    const double expected = reduceTree(0, data.size());
+
+    ASSERT_EQ(3, sums.size());
+    EXPECT_EQ(0, std::memcmp(&expected, &sums[0], sizeof(double)));
+    EXPECT_EQ(0, std::memcmp(&sums[0], &sums[1], sizeof(double)));
+    EXPECT_EQ(0, std::memcmp(&sums[0], &sums[2], sizeof(double)));
+}
@@ -0,0 +1,114 @@
+#include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/ParallelScan.h"
+
+#include "async_cpp/tasks/AsioManager.h"
+
+#include <numeric>
+#include <string>
+
+#pragma warning(disable:4251)
+#include <gtest/gtest.h>
+
+using namespace async_cpp;
+using namespace async_cpp::async;
+
+TEST(PARALLEL_SCAN_TEST, INCLUSIVE)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<size_t> data(100003, 1);
+
+    auto op = [](const size_t& left, const size_t& right)->size_t { return left + right; };
+
+    std::vector<size_t> sums;
+    ParallelScan<size_t> scan(manager, op, 0, std::move(data), ScanMode::Inclusive, 1000);
+    auto result = scan.then([&sums](std::exception_ptr ex, std::vector<size_t>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        sums = std::move(*values);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    ASSERT_EQ(100003, sums.size());
+    for(size_t i = 0; i < sums.size(); ++i)
+    {
+        ASSERT_EQ(i + 1, sums[i]);
+    }
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_SCAN_TEST, EXCLUSIVE)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<size_t> counts(10000);
+    std::iota(counts.begin(), counts.end(), 0);
+    std::vector<size_t> expected(counts.size());
+    size_t offset = 0;
+    for(size_t i = 0; i < counts.size(); ++i)
+    {
+        expected[i] = offset;
+        offset += counts[i];
+    }
+
+    auto op = [](const size_t& left, const size_t& right)->size_t { return left + right; };
+
+    std::vector<size_t> offsets;
+    ParallelScan<size_t> scan(manager, op, 0, std::move(counts), ScanMode::Exclusive, 64);
+    auto result = scan.then([&offsets](std::exception_ptr ex, std::vector<size_t>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        offsets = std::move(*values);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, offsets);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_SCAN_TEST, ORDERED)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<std::string> data;
+    for(size_t i = 0; i < 200; ++i)
+    {
+        data.push_back(std::to_string(i % 10));
+    }
+
+    auto op = [](const std::string& left, const std::string& right)->std::string { return left + right; };
+
+    std::vector<std::string> prefixes;
+    ParallelScan<std::string> scan(manager, op, std::string(), std::move(data), ScanMode::Inclusive, 7);
+    auto result = scan.then([&prefixes](std::exception_ptr ex, std::vector<std::string>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        prefixes = std::move(*values);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    ASSERT_EQ(200, prefixes.size());
+    std::string expected;
+    for(size_t i = 0; i < prefixes.size(); ++i)
+    {
+        expected += std::to_string(i % 10);
+        ASSERT_EQ(expected, prefixes[i]);
+    }
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_SCAN_TEST, EMPTY)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+
+    auto op = [](const int& left, const int& right)->int { return left + right; };
+
+    bool called = false;
+    ParallelScan<int> scan(manager, op, 0, std::vector<int>());
+    auto result = scan.then([&called](std::exception_ptr ex, std::vector<int>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        called = values->empty();
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_TRUE(called);
+
+    manager->shutdown();
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/ParallelSetOperation.h"
+
+#include "async_cpp/tasks/AsioManager.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+
+#pragma warning(disable:4251)
+#include <gtest/gtest.h>
+
+using namespace async_cpp;
+using namespace async_cpp::async;
+
+namespace {
+//sorted ids with many duplicates, so runs of equivalent ids fall across chunk boundaries
+std::vector<int> sortedIds(const unsigned seed, const size_t size)
+{
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> distribution(0, 5000);
+    std::vector<int> ids(size);
+    for(auto& id : ids)
+    {
+        id = distribution(generator);
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+}
+
+TEST(PARALLEL_SET_OPERATION_TEST, SORTED)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    auto first = sortedIds(1, 20000);
+    auto second = sortedIds(2, 15000);
+
+    std::vector<int> expectedIntersect;
+    std::set_intersection(first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(expectedIntersect));
+    std::vector<int> expectedUnion;
+    std::set_union(first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(expectedUnion));
+    std::vector<int> expectedDifference;
+    std::set_difference(first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(expectedDifference));
+
+    std::vector<int> intersected;
+    auto firstCopy = first;
+    auto secondCopy = second;
+    ParallelIntersect<int> intersect(manager, std::move(firstCopy), std::move(secondCopy), 100);
+    auto intersectResult = intersect.then([&intersected](std::exception_ptr ex, std::vector<int>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        intersected = std::move(*values);
+    } );
+    ASSERT_NO_THROW(intersectResult.check());
+    EXPECT_EQ(expectedIntersect, intersected);
+
+    std::vector<int> united;
+    firstCopy = first;
+    secondCopy = second;
+    ParallelUnion<int> unite(manager, std::move(firstCopy), std::move(secondCopy), 100);
+    auto unionResult = unite.then([&united](std::exception_ptr ex, std::vector<int>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        united = std::move(*values);
+    } );
+    ASSERT_NO_THROW(unionResult.check());
+    EXPECT_EQ(expectedUnion, united);
+
+    std::vector<int> differenced;
+    ParallelDifference<int> difference(manager, std::move(first), std::move(second), 100);
+    auto differenceResult = difference.then([&differenced](std::exception_ptr ex, std::vector<int>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        differenced = std::move(*values);
+    } );
+    ASSERT_NO_THROW(differenceResult.check());
+    EXPECT_EQ(expectedDifference, differenced);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_SET_OPERATION_TEST, HASHED)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<int> first = {5, 3, 9, 3, 1, 7, 5};
+    std::vector<int> second = {7, 2, 5, 8, 2};
+
+    auto hashOp = [](const int& value)->size_t { return std::hash<int>()(value); };
+    auto equalOp = [](const int& left, const int& right)->bool { return left == right; };
+
+    std::vector<int> intersected;
+    auto firstCopy = first;
+    auto secondCopy = second;
+    ParallelIntersect<int> intersect(manager, hashOp, equalOp, std::move(firstCopy), std::move(secondCopy), 2);
+    auto intersectResult = intersect.then([&intersected](std::exception_ptr ex, std::vector<int>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        intersected = std::move(*values);
+    } );
+    ASSERT_NO_THROW(intersectResult.check());
+    EXPECT_EQ(std::vector<int>({5, 7}), intersected);
+
+    std::vector<int> united;
+    firstCopy = first;
+    secondCopy = second;
+    ParallelUnion<int> unite(manager, hashOp, equalOp, std::move(firstCopy), std::move(secondCopy), 2);
+    auto unionResult = unite.then([&united](std::exception_ptr ex, std::vector<int>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        united = std::move(*values);
+    } );
+    ASSERT_NO_THROW(unionResult.check());
+    EXPECT_EQ(std::vector<int>({5, 3, 9, 1, 7, 2, 8}), united);
+
+    std::vector<int> differenced;
+    ParallelDifference<int> difference(manager, hashOp, equalOp, std::move(first), std::move(second), 2);
+    auto differenceResult = difference.then([&differenced](std::exception_ptr ex, std::vector<int>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        differenced = std::move(*values);
+    } );
+    ASSERT_NO_THROW(differenceResult.check());
+    EXPECT_EQ(std::vector<int>({3, 9, 1}), differenced);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_SET_OPERATION_TEST, EMPTY)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+
+    std::vector<int> united(1, -1);
+    ParallelUnion<int> unite(manager, std::vector<int>(), std::vector<int>({1, 2, 3}));
+    auto result = unite.then([&united](std::exception_ptr ex, std::vector<int>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        united = std::move(*values);
+    } );
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), united);
+
+    manager->shutdown();
+}
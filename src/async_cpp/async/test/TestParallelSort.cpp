@@ -0,0 +1,134 @@
+#include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/ParallelSort.h"
+
+#include "async_cpp/tasks/AsioManager.h"
+
+#include <random>
+#include <string>
+
+#pragma warning(disable:4251)
+#include <gtest/gtest.h>
+
+using namespace async_cpp;
+using namespace async_cpp::async;
+
+TEST(PARALLEL_SORT_TEST, RADIX_INTEGRAL)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(-1000000, 1000000);
+    std::vector<int> data(100000);
+    for(auto& value : data)
+    {
+        value = distribution(generator);
+    }
+    auto expected = data;
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<int> sorted;
+    ParallelSort<int> sort(manager, std::move(data));
+    auto result = sort.then([&sorted](std::exception_ptr ex, std::vector<int>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        sorted = std::move(*values);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, sorted);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_SORT_TEST, RADIX_FLOAT)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> distribution(-1000.0, 1000.0);
+    std::vector<double> data(50000);
+    for(auto& value : data)
+    {
+        value = distribution(generator);
+    }
+    auto expected = data;
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<double> sorted;
+    ParallelSort<double> sort(manager, std::move(data), 1000);
+    auto result = sort.then([&sorted](std::exception_ptr ex, std::vector<double>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        sorted = std::move(*values);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, sorted);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_SORT_TEST, MERGE)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::mt19937 generator(3);
+    std::vector<std::string> data(20011);
+    for(auto& value : data)
+    {
+        value = std::to_string(generator());
+    }
+    auto expected = data;
+    std::sort(expected.begin(), expected.end(), std::greater<std::string>());
+
+    std::vector<std::string> sorted;
+    auto compare = [](const std::string& left, const std::string& right)->bool { return left > right; };
+    ParallelSort<std::string> sort(manager, std::move(data), compare, 100);
+    auto result = sort.then([&sorted](std::exception_ptr ex, std::vector<std::string>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        sorted = std::move(*values);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, sorted);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_SORT_TEST, STABLE)
+{
+    typedef std::pair<int, size_t> data_t;
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<data_t> data;
+    for(size_t i = 0; i < 10000; ++i)
+    {
+        data.push_back(data_t(static_cast<int>((i * 7919) % 13), i));
+    }
+    auto expected = data;
+    auto compare = [](const data_t& left, const data_t& right)->bool { return left.first < right.first; };
+    std::stable_sort(expected.begin(), expected.end(), compare);
+
+    std::vector<data_t> sorted;
+    ParallelSort<data_t> sort(manager, std::move(data), compare, 37);
+    auto result = sort.then([&sorted](std::exception_ptr ex, std::vector<data_t>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        sorted = std::move(*values);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, sorted);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_SORT_TEST, EMPTY)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+
+    bool called = false;
+    ParallelSort<unsigned int> sort(manager, std::vector<unsigned int>());
+    auto result = sort.then([&called](std::exception_ptr ex, std::vector<unsigned int>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        called = values->empty();
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_TRUE(called);
+
+    manager->shutdown();
+}
\ No newline at end of file
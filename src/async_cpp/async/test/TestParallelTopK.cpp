@@ -0,0 +1,151 @@
+#include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/ParallelMinMax.h"
+#include "async_cpp/async/ParallelTopK.h"
+
+#include "async_cpp/tasks/AsioManager.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#pragma warning(disable:4251)
+#include <gtest/gtest.h>
+
+using namespace async_cpp;
+using namespace async_cpp::async;
+
+TEST(PARALLEL_TOP_K_TEST, GREATEST)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<int> data(100000);
+    std::iota(data.begin(), data.end(), 0);
+    std::shuffle(data.begin(), data.end(), std::mt19937(42));
+
+    std::vector<int> expected(100);
+    std::iota(expected.rbegin(), expected.rend(), static_cast<int>(data.size() - expected.size()));
+
+    std::vector<int> selected;
+    ParallelTopK<int> topK(manager, std::move(data), expected.size(), 1000);
+    auto result = topK.then([&selected](std::exception_ptr ex, std::vector<int>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        selected = std::move(*values);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, selected);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_TOP_K_TEST, COMPARE)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    //scores with many ties, paired with their position in the data
+    std::vector<std::pair<int, size_t>> data;
+    for(size_t i = 0; i < 10000; ++i)
+    {
+        data.emplace_back(static_cast<int>(i % 10), i);
+    }
+    auto expected = data;
+    std::stable_sort(expected.begin(), expected.end(), [](const std::pair<int, size_t>& left, const std::pair<int, size_t>& right)->bool
+    {
+        return left.first > right.first;
+    } );
+    expected.resize(50);
+
+    std::vector<std::pair<int, size_t>> selected;
+    ParallelTopK<std::pair<int, size_t>> topK(manager, std::move(data), expected.size(), 
+        [](const std::pair<int, size_t>& left, const std::pair<int, size_t>& right)->bool { return left.first < right.first; }, 
+        77);
+    auto result = topK.then([&selected](std::exception_ptr ex, std::vector<std::pair<int, size_t>>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        selected = std::move(*values);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, selected);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_TOP_K_TEST, FEWER_THAN_K)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<int> data = {3, 1, 2};
+
+    std::vector<int> selected;
+    ParallelTopK<int> topK(manager, std::move(data), 10, 1);
+    auto result = topK.then([&selected](std::exception_ptr ex, std::vector<int>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        selected = std::move(*values);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(std::vector<int>({3, 2, 1}), selected);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_MIN_MAX_TEST, MIN_MAX)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<int> data(100000);
+    std::iota(data.begin(), data.end(), -50000);
+    std::shuffle(data.begin(), data.end(), std::mt19937(7));
+
+    std::pair<int, int> minMax;
+    ParallelMinMax<int> search(manager, std::move(data), 1000);
+    auto result = search.then([&minMax](std::exception_ptr ex, std::pair<int, int>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        minMax = *values;
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(-50000, minMax.first);
+    EXPECT_EQ(49999, minMax.second);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_MIN_MAX_TEST, FIRST_MIN_LAST_MAX)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<std::pair<int, size_t>> data;
+    for(size_t i = 0; i < 1000; ++i)
+    {
+        data.emplace_back(static_cast<int>(i % 3), i);
+    }
+
+    std::pair<std::pair<int, size_t>, std::pair<int, size_t>> minMax;
+    ParallelMinMax<std::pair<int, size_t>> search(manager, std::move(data), 
+        [](const std::pair<int, size_t>& left, const std::pair<int, size_t>& right)->bool { return left.first < right.first; }, 
+        10);
+    auto result = search.then([&minMax](std::exception_ptr ex, 
+        std::pair<std::pair<int, size_t>, std::pair<int, size_t>>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        minMax = *values;
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(0, minMax.first.second);
+    EXPECT_EQ(998, minMax.second.second);
+
+    manager->shutdown();
+}
+
+TEST(PARALLEL_MIN_MAX_TEST, EMPTY)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+
+    bool isNull = false;
+    ParallelMinMax<int> search(manager, std::vector<int>());
+    auto result = search.then([&isNull](std::exception_ptr ex, std::pair<int, int>* values)->void {
+        if(ex) std::rethrow_exception(ex);
+        isNull = (nullptr == values);
+    } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_TRUE(isNull);
+
+    manager->shutdown();
+}
@@ -0,0 +1,102 @@
+#include "async_cpp/async/AsyncResult.h"
+#include "async_cpp/async/Pipeline.h"
+
+#include "async_cpp/tasks/AsioManager.h"
+
+#include <numeric>
+#include <string>
+
+#pragma warning(disable:4251)
+#include <gtest/gtest.h>
+
+using namespace async_cpp;
+using namespace async_cpp::async;
+
+TEST(PIPELINE_TEST, MAP_FILTER_REDUCE)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<int> data(100000);
+    std::iota(data.begin(), data.end(), 0);
+    long long expected = 0;
+    for(auto value : data)
+    {
+        long long squared = static_cast<long long>(value) * value;
+        if(squared % 3 == 0) expected += squared;
+    }
+
+    long long sum = 0;
+    Pipeline<int> pipeline(manager, std::move(data), 1000);
+    auto result = pipeline.map<long long>([](const int& value)->long long { return static_cast<long long>(value) * value; })
+        .filter([](const long long& value)->bool { return value % 3 == 0; })
+        .reduce(0, [](long long&& left, long long&& right)->long long { return left + right; }, 
+            [&sum](std::exception_ptr ex, long long* value)->void {
+                if(ex) std::rethrow_exception(ex);
+                sum = *value;
+            } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, sum);
+
+    manager->shutdown();
+}
+
+TEST(PIPELINE_TEST, COLLECT)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<int> data(10000);
+    std::iota(data.begin(), data.end(), 0);
+    std::vector<std::string> expected;
+    for(auto value : data)
+    {
+        if(value % 7 == 0) expected.push_back(std::to_string(value));
+    }
+
+    std::vector<std::string> collected;
+    Pipeline<int> pipeline(manager, std::move(data), 64);
+    auto filtered = pipeline.filter([](const int& value)->bool { return value % 7 == 0; });
+    auto result = filtered.map<std::string>([](const int& value)->std::string { return std::to_string(value); })
+        .collect([&collected](std::exception_ptr ex, std::vector<std::string>&& results)->void {
+            if(ex) std::rethrow_exception(ex);
+            collected = std::move(results);
+        } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, collected);
+
+    //data is not consumed, so the same stages can run again
+    int sum = 0;
+    auto sumResult = filtered.reduce(0, [](int&& left, int&& right)->int { return left + right; }, 
+        [&sum](std::exception_ptr ex, int* value)->void {
+            if(ex) std::rethrow_exception(ex);
+            sum = *value;
+        } );
+    ASSERT_NO_THROW(sumResult.check());
+    int expectedSum = 0;
+    for(auto& value : expected)
+    {
+        expectedSum += std::stoi(value);
+    }
+    EXPECT_EQ(expectedSum, sum);
+
+    manager->shutdown();
+}
+
+TEST(PIPELINE_TEST, FAILURE)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    std::vector<int> data(1000, 1);
+    data[700] = 0;
+
+    Pipeline<int> pipeline(manager, std::move(data), 10);
+    auto result = pipeline.map<int>([](const int& value)->int { 
+            if(0 == value) throw(std::runtime_error("Zero value"));
+            return 10 / value;
+        } )
+        .collect([](std::exception_ptr ex, std::vector<int>&&)->void {
+            if(ex) std::rethrow_exception(ex);
+        } );
+
+    ASSERT_THROW(result.check(), std::runtime_error);
+
+    manager->shutdown();
+}
\ No newline at end of file
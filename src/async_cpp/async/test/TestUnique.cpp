@@ -4,6 +4,8 @@
 #include "async_cpp/tasks/AsioManager.h"
 
 #include <chrono>
+#include <random>
+#include <unordered_set>
 
 #pragma warning(disable:4251)
 #include <gtest/gtest.h>
@@ -50,4 +52,109 @@ TEST(UNIQUE_TEST, BASIC)
     EXPECT_NO_THROW(result.check());
 
     manager->shutdown();
-}
\ No newline at end of file
+}
+
+namespace {
+std::vector<int> makeRepeatedData(const size_t size)
+{
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<int> distribution(0, 5000);
+    std::vector<int> data(size);
+    for(auto& value : data)
+    {
+        value = distribution(generator);
+    }
+    return data;
+}
+
+std::vector<int> firstOccurrences(const std::vector<int>& data)
+{
+    std::unordered_set<int> seen;
+    std::vector<int> firsts;
+    for(auto value : data)
+    {
+        if(seen.insert(value).second) firsts.push_back(value);
+    }
+    return firsts;
+}
+}
+
+TEST(UNIQUE_TEST, HASHED)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    auto data = makeRepeatedData(200000);
+    auto expected = firstOccurrences(data);
+
+    auto hashOp = [](const int& a) -> size_t {
+        return std::hash<int>()(a);
+    };
+    auto equalOp = [](const int& a, const int& b) -> bool {
+        return a == b;
+    };
+
+    std::vector<int> unique;
+    auto result = Unique<int>(manager, hashOp, equalOp, std::move(data)).then(
+        [&unique](std::exception_ptr ex, std::vector<int>&& results)->void {
+            if(ex) std::rethrow_exception(ex);
+            unique = std::move(results);
+        } );
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, unique);
+
+    manager->shutdown();
+}
+
+TEST(UNIQUE_TEST, SORTED)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+    auto data = makeRepeatedData(200000);
+    auto expected = firstOccurrences(data);
+
+    std::vector<int> unique;
+    auto result = Unique<int>(manager, std::move(data)).then(
+        [&unique](std::exception_ptr ex, std::vector<int>&& results)->void {
+            if(ex) std::rethrow_exception(ex);
+            unique = std::move(results);
+        } );
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(expected, unique);
+
+    manager->shutdown();
+}
+namespace {
+//only comparable for equality, so the sort based variant cannot be used
+struct Unordered {
+    int mValue;
+};
+}
+
+TEST(UNIQUE_TEST, EQUALITY_ONLY)
+{
+    auto manager(std::make_shared<tasks::AsioManager>(5));
+
+    std::vector<Unordered> data;
+    for(int value : {1, 2, 1, 3, 2})
+    {
+        data.push_back(Unordered{value});
+    }
+
+    auto equalOp = [](const Unordered& a, const Unordered& b) -> bool {
+        return a.mValue == b.mValue;
+    };
+
+    std::vector<int> unique;
+    auto result = Unique<Unordered>(manager, equalOp, std::move(data)).then(
+        [&unique](std::exception_ptr ex, std::vector<Unordered>&& results)->void
+        {
+            if(ex) std::rethrow_exception(ex);
+            for(auto& item : results)
+            {
+                unique.push_back(item.mValue);
+            }
+        } );
+
+    ASSERT_NO_THROW(result.check());
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), unique);
+
+    manager->shutdown();
+}
@@ -2,50 +2,136 @@
 #include "async_cpp/tasks/Task.h"
 
 #include <boost/thread/thread.hpp>
+#include <deque>
+#include <thread>
+#include <vector>
 
 namespace async_cpp {
 namespace tasks {
 
+namespace {
+/**
+ * Worker slot of the calling thread, identifying which manager's tasks it was created for.
+ */
+struct WorkerSlot {
+    size_t mTasksId;
+    size_t mIndex;
+};
+thread_local WorkerSlot tWorker = {0, 0};
+std::atomic<size_t> sNextTasksId(1);
+}
+
 //------------------------------------------------------------------------------
 class AsioManager::Tasks {
 public:
-    Tasks()
+    Tasks(const size_t nbWorkers)
+        : mId(sNextTasksId++), mQueued(0), mClosed(false)
     {
+        for(size_t i = 0; i < nbWorkers; ++i)
+        {
+            mWorkers.emplace_back(new WorkerQueue());
+        }
+    }
 
+    /**
+     * Mark the calling thread as one of this manager's workers, giving it a local queue.
+     * @param index Index of worker
+     */
+    void registerWorker(const size_t index)
+    {
+        tWorker.mTasksId = mId;
+        tWorker.mIndex = index;
     }
 
+    /**
+     * Take the next task for the calling thread. Workers take the newest task from their own queue first so nested 
+     * work runs depth first, then the oldest shared task, then steal the oldest task of another worker.
+     */
     std::shared_ptr<Task> get()
     {
         std::shared_ptr<Task> task;
+        auto local = localQueue();
+        if(local)
+        {
+            std::lock_guard<std::mutex> lock(local->mMutex);
+            if(!local->mTasks.empty())
+            {
+                task = local->mTasks.back();
+                local->mTasks.pop_back();
+            }
+        }
+
+        if(!task)
         {
             std::lock_guard<std::mutex> lock(mMutex);
             if(!mTasks.empty())
             {
                 task = mTasks.front();
-                mTasks.pop();
+                mTasks.pop_front();
             }
         }
+
+        const size_t first = local ? tWorker.mIndex + 1 : 0;
+        for(size_t i = 0; !task && i < mWorkers.size(); ++i)
+        {
+            auto& worker = *mWorkers[(first + i) % mWorkers.size()];
+            std::lock_guard<std::mutex> lock(worker.mMutex);
+            if(!worker.mTasks.empty())
+            {
+                task = worker.mTasks.front();
+                worker.mTasks.pop_front();
+            }
+        }
+
+        if(task) --mQueued;
         return task;
     }
 
+    /**
+     * Queue a task, on the calling worker's own queue if called from one of this manager's workers.
+     * @param task Task to queue
+     */
     void add(std::shared_ptr<Task> task)
     {
-        std::lock_guard<std::mutex> lock(mMutex);
-        mTasks.push(task);
+        ++mQueued;
+        auto local = localQueue();
+        if(local)
+        {
+            std::lock_guard<std::mutex> lock(local->mMutex);
+            local->mTasks.push_back(task);
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mTasks.push_back(task);
+        }
+
+        //a worker may add a task while the manager shuts down, after queues were cancelled
+        if(mClosed)
+        {
+            cancel();
+            notifyCompletion();
+        }
     }
 
+    /**
+     * Cancel all queued tasks, and any tasks added afterwards.
+     */
     void cancel()
     {
-        std::lock_guard<std::mutex> lock(mMutex);
-        while(!mTasks.empty())
+        mClosed = true;
+        while(auto task = get())
         {
-            mTasks.front()->cancel();
-            mTasks.pop();
+            task->cancel();
         }
     }
 
     void notifyCompletion()
     {
+        //queued count changes outside of the mutex, lock so a waiter cannot miss the signal
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+        }
         mTaskCompleteSignal.notify_all();
     }
 
@@ -54,19 +140,33 @@ public:
         std::unique_lock<std::mutex> lock(mMutex);
         mTaskCompleteSignal.wait(lock, [this]()->bool 
         {
-            return mTasks.empty();
+            return 0 == mQueued;
         } );
     }
 
 private:
+    struct WorkerQueue {
+        std::mutex mMutex;
+        std::deque<std::shared_ptr<Task>> mTasks;
+    };
+
+    WorkerQueue* localQueue() const
+    {
+        return (tWorker.mTasksId == mId) ? mWorkers[tWorker.mIndex].get() : nullptr;
+    }
+
+    const size_t mId;
     std::mutex mMutex;
-    std::queue<std::shared_ptr<Task>> mTasks;
+    std::deque<std::shared_ptr<Task>> mTasks;
+    std::vector<std::unique_ptr<WorkerQueue>> mWorkers;
+    std::atomic<size_t> mQueued;
+    std::atomic_bool mClosed;
     std::condition_variable mTaskCompleteSignal;
 };
 
 //------------------------------------------------------------------------------
 AsioManager::AsioManager(const size_t nbThreads, std::shared_ptr<boost::asio::io_service> service)
-    : IManager(), mNbThreads(nbThreads), mCreatedService(false), mTasks(std::make_shared<Tasks>())
+    : IManager(), mNbThreads(nbThreads), mCreatedService(false), mTasks(std::make_shared<Tasks>(nbThreads))
 {
     if(!service)
     {
@@ -81,7 +181,8 @@ AsioManager::AsioManager(const size_t nbThreads, std::shared_ptr<boost::asio::io
     auto tasks = mTasks;
     for(size_t i = 0; i < nbThreads; ++i)
     {
-        mThreads->create_thread([service]()->void {
+        mThreads->create_thread([service, tasks, i]()->void {
+            tasks->registerWorker(i);
             service->run();
         });
     }
@@ -111,12 +212,22 @@ void AsioManager::shutdown()
         //cancel the remaining tasks that aren't running
         mTasks->cancel();
         mTasks->waitForTasksToComplete();
-        mTasks.reset();
 
-        //stop all the threads
+        //stop all the threads, a worker releasing the last reference to this manager cannot join itself
         mThreads->interrupt_all();
-        mThreads->join_all();
-        mThreads.reset();
+        if(mThreads->is_this_thread_in())
+        {
+            std::shared_ptr<boost::thread_group> threads(mThreads.release());
+            std::thread([threads]()->void
+            {
+                threads->join_all();
+            } ).detach();
+        }
+        else
+        {
+            mThreads->join_all();
+            mThreads.reset();
+        }
     }
 }
 
@@ -126,6 +237,51 @@ void AsioManager::waitForTasksToComplete()
     mTasks->waitForTasksToComplete();
 }
 
+//------------------------------------------------------------------------------
+bool AsioManager::runQueuedTask()
+{
+    if(mRunning.load())
+    {
+        auto task = mTasks->get();
+        if(task)
+        {
+            perform(this, task);
+            mTasks->notifyCompletion();
+            return true;
+        }
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+void AsioManager::perform(IManager* manager, std::shared_ptr<Task> task)
+{
+    auto previous = setCurrent(manager);
+    task->perform();
+    setCurrent(previous);
+}
+
+//------------------------------------------------------------------------------
+void AsioManager::queue(IManager* manager, 
+    std::shared_ptr<Tasks> tasks, 
+    boost::asio::io_service& service, 
+    std::shared_ptr<Task> task)
+{
+    //the manager need not be owned by a shared_ptr. Shutdown cancels queued tasks and closes the queues, so a handler 
+    //run after the manager is gone finds no task and never uses it
+    tasks->add(task);
+    service.post([manager, tasks]()->void
+    {
+        //task may have already been run by a thread helping while waiting
+        auto task = tasks->get();
+        if(task)
+        {
+            perform(manager, task);
+        }
+        tasks->notifyCompletion();
+    } );
+}
+
 //------------------------------------------------------------------------------
 void AsioManager::run(std::shared_ptr<Task> task)
 {
@@ -133,17 +289,7 @@ void AsioManager::run(std::shared_ptr<Task> task)
     {
         if(mRunning.load())
         {
-            mTasks->add(task);
-            auto tasks = mTasks;
-            mService->post([tasks]()->void
-            {
-                auto task = tasks->get();
-                if(task)
-                {
-                    task->perform();
-                }
-                tasks->notifyCompletion();
-            } );
+            queue(this, mTasks, *mService, task);
         }  
         else
         {
@@ -166,21 +312,17 @@ void AsioManager::run(std::shared_ptr<Task> task, const std::chrono::high_resolu
             }
             else
             {
-                std::weak_ptr<IManager> managerPtr = shared_from_this();
+                //as with run, the timer holds the queues rather than the manager. Queues closed once the manager shuts 
+                //down cancel the task when it is added
+                IManager* manager = this;
+                auto tasks = mTasks;
+                auto service = mService.get();
                 auto taskRunTimer = std::make_shared<boost::asio::deadline_timer>(*mService, boost::posix_time::microseconds((long)dur.count()));
-                taskRunTimer->async_wait([task, taskRunTimer, managerPtr](const boost::system::error_code& ec)->void 
+                taskRunTimer->async_wait([task, taskRunTimer, manager, tasks, service](const boost::system::error_code& ec)->void 
                 {
                     if(!ec)
                     {
-                        auto manager = managerPtr.lock();
-                        if(manager)
-                        {
-                            manager->run(task);
-                        }
-                        else
-                        {
-                            task->cancel();
-                        }
+                        queue(manager, tasks, *service, task);
                     }
                     else
                     {
@@ -17,7 +17,10 @@ namespace async_cpp {
 namespace tasks {
 
 /**
- * Manager of a set of workers, which are used to run tasks. If no workers are available, tasks are queue'd.
+ * Manager of a set of workers, which are used to run tasks. If no workers are available, tasks are queue'd. Tasks run 
+ * from one of the manager's own workers, such as the inner tasks of nested parallel algorithms, are queued locally to 
+ * that worker. Workers take their newest local task first, so nested work runs depth first on the worker which spawned 
+ * it, then shared tasks, then steal the oldest local tasks of other workers when idle.
  */
 class ASYNC_CPP_TASKS_API AsioManager : public IManager {
 public:
@@ -33,6 +36,7 @@ public:
     virtual void run(std::shared_ptr<Task> task, const std::chrono::high_resolution_clock::time_point& time) final;
     virtual void shutdown() final;
     virtual void waitForTasksToComplete();
+    virtual bool runQueuedTask() final;
 
     inline virtual const bool isRunning() final;
 
@@ -44,6 +48,12 @@ public:
 protected:
     class Tasks;
 
+    static void perform(IManager* manager, std::shared_ptr<Task> task);
+    static void queue(IManager* manager, 
+        std::shared_ptr<Tasks> tasks, 
+        boost::asio::io_service& service, 
+        std::shared_ptr<Task> task);
+
     std::shared_ptr<Tasks> mTasks;
     std::atomic_bool mRunning;
     std::shared_ptr<boost::asio::io_service> mService;
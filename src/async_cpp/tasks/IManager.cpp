@@ -3,11 +3,35 @@
 namespace async_cpp {
 namespace tasks {
 
+namespace {
+thread_local IManager* tCurrentManager = nullptr;
+}
+
 //------------------------------------------------------------------------------
 IManager::~IManager()
 {
 
 }
 
+//------------------------------------------------------------------------------
+bool IManager::runQueuedTask()
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------
+IManager* IManager::current()
+{
+    return tCurrentManager;
+}
+
+//------------------------------------------------------------------------------
+IManager* IManager::setCurrent(IManager* manager)
+{
+    auto previous = tCurrentManager;
+    tCurrentManager = manager;
+    return previous;
+}
+
 }
 }
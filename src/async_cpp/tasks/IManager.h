@@ -7,6 +7,10 @@
 namespace async_cpp {
 namespace tasks {
 
+#if defined(__cpp_impl_coroutine)
+class ScheduleAwaiter;
+#endif
+
 /**
  * Interface for managers, allowing replacement/mocks.
  */
@@ -41,10 +45,43 @@ public:
      * @return True if manager is running
      */
     virtual const bool isRunning() = 0;
+
+    /**
+     * Run a single queued task on the calling thread, if one is available. Allows a thread waiting on a result to help
+     * complete outstanding work instead of blocking.
+     * @return True if a task was run
+     */
+    virtual bool runQueuedTask();
+
+    /**
+     * Retrieve the manager whose task is being performed by the calling thread.
+     * @return Manager running on this thread, null if calling thread is not performing a managed task
+     */
+    static IManager* current();
+
+#if defined(__cpp_impl_coroutine)
+    /**
+     * Create an awaitable which resumes the awaiting coroutine as a task run by this manager.
+     * @return Awaitable to co_await
+     */
+    inline ScheduleAwaiter schedule();
+#endif
+
+protected:
+    /**
+     * Mark the calling thread as performing tasks for a manager.
+     * @param manager Manager whose tasks are being performed, null if none
+     * @return Manager previously marked for the calling thread
+     */
+    static IManager* setCurrent(IManager* manager);
 };
 
 //inline implementations
 //------------------------------------------------------------------------------
 
 }
-}
\ No newline at end of file
+}
+
+#if defined(__cpp_impl_coroutine)
+#include "async_cpp/tasks/ScheduleAwaiter.h"
+#endif
\ No newline at end of file
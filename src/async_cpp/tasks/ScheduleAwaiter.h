@@ -0,0 +1,115 @@
+#pragma once
+#include "async_cpp/tasks/IManager.h"
+#include "async_cpp/tasks/Task.h"
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#include <stdexcept>
+
+namespace async_cpp {
+namespace tasks {
+
+/**
+ * Awaitable which suspends a coroutine, resuming it as a task run by a manager. If the manager cancels the task, 
+ * the coroutine is resumed and the co_await expression throws.
+ */
+class ScheduleAwaiter {
+public:
+    /**
+     * Create an awaitable that will resume on a manager.
+     * @param manager Manager to run the resumed coroutine
+     */
+    inline ScheduleAwaiter(IManager& manager);
+
+    inline bool await_ready() const;
+    inline void await_suspend(std::coroutine_handle<> handle);
+    inline void await_resume() const;
+
+private:
+    class ResumeTask;
+
+    IManager& mManager;
+    bool mCancelled;
+};
+
+/**
+ * Task which resumes a suspended coroutine.
+ */
+//------------------------------------------------------------------------------
+class ScheduleAwaiter::ResumeTask : public Task {
+public:
+    inline ResumeTask(std::coroutine_handle<> handle, bool& cancelled);
+    inline virtual ~ResumeTask();
+
+protected:
+    inline virtual void performSpecific() final;
+    inline virtual void notifyCancel() final;
+
+private:
+    std::coroutine_handle<> mHandle;
+    bool& mCancelled;
+};
+
+//inline implementations
+//------------------------------------------------------------------------------
+ScheduleAwaiter::ScheduleAwaiter(IManager& manager)
+    : mManager(manager), mCancelled(false)
+{
+
+}
+
+//------------------------------------------------------------------------------
+bool ScheduleAwaiter::await_ready() const
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------
+void ScheduleAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    mManager.run(std::make_shared<ResumeTask>(handle, mCancelled));
+}
+
+//------------------------------------------------------------------------------
+void ScheduleAwaiter::await_resume() const
+{
+    if(mCancelled) { throw(std::runtime_error("Cancelled")); }
+}
+
+//------------------------------------------------------------------------------
+ScheduleAwaiter::ResumeTask::ResumeTask(std::coroutine_handle<> handle, bool& cancelled)
+    : Task(), mHandle(handle), mCancelled(cancelled)
+{
+
+}
+
+//------------------------------------------------------------------------------
+ScheduleAwaiter::ResumeTask::~ResumeTask()
+{
+
+}
+
+//------------------------------------------------------------------------------
+void ScheduleAwaiter::ResumeTask::performSpecific()
+{
+    mHandle.resume();
+}
+
+//------------------------------------------------------------------------------
+void ScheduleAwaiter::ResumeTask::notifyCancel()
+{
+    //coroutine must still be resumed, otherwise it is never destroyed
+    mCancelled = true;
+    mHandle.resume();
+}
+
+//------------------------------------------------------------------------------
+ScheduleAwaiter IManager::schedule()
+{
+    return ScheduleAwaiter(*this);
+}
+
+}
+}
+
+#endif
\ No newline at end of file
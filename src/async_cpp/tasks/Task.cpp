@@ -39,7 +39,7 @@ void Task::buildMembers()
             }
             return false;
         } );
-    mTaskCompleteFuture = mTask.get_future();
+    mTaskCompleteFuture = mTask.get_future().share();
 }
 
 //------------------------------------------------------------------------------
@@ -61,7 +61,7 @@ void Task::notifyCancel()
 }
 
 //------------------------------------------------------------------------------
-void Task::cancel()
+bool Task::cancel()
 {
     bool wasInvoked = mTaskInvoked.exchange(true);
     if(!wasInvoked) 
@@ -69,6 +69,22 @@ void Task::cancel()
         mTask(true);
         this->notifyCancel();
     }
+    return !wasInvoked;
+}
+
+//------------------------------------------------------------------------------
+WaitStatus Task::waitUntil(const std::chrono::steady_clock::time_point& time, const bool cancelOnTimeout)
+{
+    if(std::future_status::ready != mTaskCompleteFuture.wait_until(time))
+    {
+        if(cancelOnTimeout)
+        {
+            //only has an effect if task has not started performing
+            cancel();
+        }
+        return WaitStatus::Timeout;
+    }
+    return mTaskCompleteFuture.get() ? WaitStatus::Ready : WaitStatus::Failed;
 }
 
 //------------------------------------------------------------------------------
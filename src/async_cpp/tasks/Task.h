@@ -2,6 +2,7 @@
 #include "async_cpp/tasks/Tasks.h"
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <future>
 
@@ -28,6 +29,23 @@ public:
      */
     inline bool wasSuccessful();
 
+    /**
+     * Wait a bounded amount of time for this task to complete.
+     * @param duration Maximum time to wait
+     * @param cancelOnTimeout Cancel this task if it has not been performed in time
+     * @return Ready if task completed successfully, Failed if unsuccessful, Timeout if not complete in time
+     */
+    template<class TREP, class TPERIOD>
+    WaitStatus waitFor(const std::chrono::duration<TREP, TPERIOD>& duration, const bool cancelOnTimeout = false);
+
+    /**
+     * Wait until a point in time for this task to complete.
+     * @param time Time to stop waiting at
+     * @param cancelOnTimeout Cancel this task if it has not been performed in time
+     * @return Ready if task completed successfully, Failed if unsuccessful, Timeout if not complete in time
+     */
+    WaitStatus waitUntil(const std::chrono::steady_clock::time_point& time, const bool cancelOnTimeout = false);
+
     /**
      * Perform the behavior of this task
      */
@@ -35,8 +53,9 @@ public:
 
     /**
      * Mark this task as a failure by fulfilling its promise with false.
+     * @return True if the task was cancelled, false if it was already performed or cancelled
      */
-    void cancel();
+    bool cancel();
 
     /**
      * Notify this task of an exception occurring.
@@ -53,7 +72,7 @@ private:
 
     void buildMembers();
 
-    std::future<bool> mTaskCompleteFuture;
+    std::shared_future<bool> mTaskCompleteFuture;
     std::atomic_bool mTaskInvoked;
     std::packaged_task<bool(bool)> mTask;
 };
@@ -75,5 +94,12 @@ bool Task::wasSuccessful()
     return mTaskCompleteFuture.get();
 }
 
+//------------------------------------------------------------------------------
+template<class TREP, class TPERIOD>
+WaitStatus Task::waitFor(const std::chrono::duration<TREP, TPERIOD>& duration, const bool cancelOnTimeout)
+{
+    return waitUntil(std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(duration), cancelOnTimeout);
+}
+
 }
 }
\ No newline at end of file
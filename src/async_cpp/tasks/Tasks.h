@@ -11,5 +11,14 @@ class IManager;
 typedef std::shared_ptr<IManager> ManagerPtr;
 class Task;
 
+/**
+ * Outcome of waiting a bounded amount of time for completion.
+ */
+enum class WaitStatus {
+    Ready,   //completed successfully
+    Timeout, //not completed in time
+    Failed   //completed unsuccessfully
+};
+
 }
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #pragma warning(disable:4251)
 #include <gtest/gtest.h>
 
+#include<atomic>
 #include<thread>
 using namespace async_cpp::tasks;
 
@@ -30,6 +31,28 @@ private:
     }
 };
 
+class CurrentManagerTask : public Task
+{
+public:
+    CurrentManagerTask() : currentManager(nullptr)
+    {
+
+    }
+
+    virtual ~CurrentManagerTask()
+    {
+
+    }
+
+    IManager* currentManager;
+
+private:
+    virtual void performSpecific() final
+    {
+        currentManager = IManager::current();
+    }
+};
+
 TEST(ASIO_MANAGER_TEST, BASIC_TEST)
 {
     //setup a bunch of tasks
@@ -162,3 +185,198 @@ TEST(ASIO_MANAGER_TEST, RESET_WHILE_TASKS_RUNNING)
         task->wasSuccessful();
     }
 }
+
+TEST(ASIO_MANAGER_TEST, RUN_QUEUED_TASK)
+{
+    auto manager = std::make_shared<AsioManager>(1);
+    EXPECT_EQ(nullptr, IManager::current());
+
+    //occupy the only worker, so the next task stays queued
+    auto blockingTask = std::make_shared<AsioTestTask>();
+    auto queuedTask = std::make_shared<CurrentManagerTask>();
+    manager->run(blockingTask);
+    manager->run(queuedTask);
+
+    //either helping ran the task or the worker did, either way it ran against this manager
+    manager->runQueuedTask();
+    ASSERT_TRUE(queuedTask->wasSuccessful());
+    EXPECT_EQ(manager.get(), queuedTask->currentManager);
+    EXPECT_EQ(nullptr, IManager::current());
+
+    ASSERT_TRUE(blockingTask->wasSuccessful());
+    EXPECT_FALSE(manager->runQueuedTask());
+}
+
+class OrderTask : public Task
+{
+public:
+    OrderTask(std::vector<size_t>& order, const size_t id) : mOrder(order), mId(id)
+    {
+
+    }
+
+    virtual ~OrderTask()
+    {
+
+    }
+
+private:
+    virtual void performSpecific() final
+    {
+        mOrder.push_back(mId);
+    }
+
+    std::vector<size_t>& mOrder;
+    size_t mId;
+};
+
+class NestingTask : public Task
+{
+public:
+    NestingTask() : mOrder()
+    {
+
+    }
+
+    virtual ~NestingTask()
+    {
+
+    }
+
+    std::vector<size_t> mOrder;
+
+private:
+    virtual void performSpecific() final
+    {
+        //tasks queued from a worker stay local to it, and are helped with newest first
+        auto manager = IManager::current();
+        for(size_t i = 0; i < 3; ++i)
+        {
+            manager->run(std::make_shared<OrderTask>(mOrder, i));
+        }
+        while(manager->runQueuedTask())
+        {
+
+        }
+    }
+};
+
+TEST(ASIO_MANAGER_TEST, NESTED_DEPTH_FIRST)
+{
+    auto manager = std::make_shared<AsioManager>(1);
+
+    auto task = std::make_shared<NestingTask>();
+    manager->run(task);
+    ASSERT_TRUE(task->wasSuccessful());
+    EXPECT_EQ(std::vector<size_t>({2, 1, 0}), task->mOrder);
+
+    manager->shutdown();
+}
+
+class CountTask : public Task
+{
+public:
+    CountTask(std::atomic<size_t>& count) : mCount(count)
+    {
+
+    }
+
+    virtual ~CountTask()
+    {
+
+    }
+
+private:
+    virtual void performSpecific() final
+    {
+        ++mCount;
+    }
+
+    std::atomic<size_t>& mCount;
+};
+
+class SpawnAndBlockTask : public Task
+{
+public:
+    SpawnAndBlockTask() : mAllRan(false)
+    {
+        mCount.store(0);
+    }
+
+    virtual ~SpawnAndBlockTask()
+    {
+
+    }
+
+    bool mAllRan;
+
+private:
+    virtual void performSpecific() final
+    {
+        //queue local tasks then block without helping, so only another worker stealing can run them
+        auto manager = IManager::current();
+        for(size_t i = 0; i < 5; ++i)
+        {
+            manager->run(std::make_shared<CountTask>(mCount));
+        }
+        auto end = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while(mCount < 5 && std::chrono::steady_clock::now() < end)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        mAllRan = (5 == mCount);
+    }
+
+    std::atomic<size_t> mCount;
+};
+
+TEST(ASIO_MANAGER_TEST, NESTED_STEAL)
+{
+    auto manager = std::make_shared<AsioManager>(2);
+
+    auto task = std::make_shared<SpawnAndBlockTask>();
+    manager->run(task);
+    ASSERT_TRUE(task->wasSuccessful());
+    EXPECT_TRUE(task->mAllRan);
+
+    manager->shutdown();
+}
+
+TEST(ASIO_MANAGER_TEST, STACK_MANAGER)
+{
+    //a manager not owned by a shared_ptr can still run and help with tasks
+    std::vector< std::shared_ptr<CurrentManagerTask> > tasks;
+    {
+        AsioManager manager(1);
+        auto blockingTask = std::make_shared<AsioTestTask>();
+        manager.run(blockingTask);
+        for(size_t i = 0; i < 5; ++i)
+        {
+            tasks.emplace_back(std::make_shared<CurrentManagerTask>());
+            manager.run(tasks.back());
+        }
+
+        while(manager.runQueuedTask())
+        {
+
+        }
+        manager.waitForTasksToComplete();
+        for(auto task : tasks)
+        {
+            ASSERT_TRUE(task->wasSuccessful());
+            EXPECT_EQ(&manager, task->currentManager);
+        }
+
+        //timed tasks are queued once due without the manager being owned
+        auto timedTask = std::make_shared<CurrentManagerTask>();
+        manager.run(timedTask, std::chrono::high_resolution_clock::now() + std::chrono::milliseconds(5));
+        ASSERT_TRUE(timedTask->wasSuccessful());
+        EXPECT_EQ(&manager, timedTask->currentManager);
+
+        //queued when the manager is destroyed, cancelled rather than run
+        tasks.emplace_back(std::make_shared<CurrentManagerTask>());
+        manager.run(std::make_shared<AsioTestTask>());
+        manager.run(tasks.back());
+    }
+    EXPECT_EQ(nullptr, IManager::current());
+}
@@ -140,4 +140,26 @@ TEST(TASKS_TEST, EXCEPTION_TASK)
 
     EXPECT_FALSE(task.wasSuccessful()); //task failed due to exception
     EXPECT_TRUE(task.hadException);
+}
+
+TEST(TASKS_TEST, WAIT_FOR)
+{
+    TestTask task;
+
+    EXPECT_EQ(WaitStatus::Timeout, task.waitFor(std::chrono::milliseconds(1)));
+    EXPECT_FALSE(task.failedToPerform);
+
+    std::thread performer([&task]()->void {
+        task.perform();
+    } );
+    EXPECT_EQ(WaitStatus::Ready, task.waitFor(std::chrono::seconds(5)));
+    EXPECT_TRUE(task.wasSuccessful());
+    performer.join();
+
+    TestTask cancelledTask;
+    EXPECT_EQ(WaitStatus::Timeout, cancelledTask.waitUntil(std::chrono::steady_clock::now() + std::chrono::milliseconds(1), true));
+    EXPECT_TRUE(cancelledTask.failedToPerform);
+    EXPECT_EQ(WaitStatus::Failed, cancelledTask.waitFor(std::chrono::milliseconds(1)));
+    cancelledTask.perform();
+    EXPECT_FALSE(cancelledTask.wasPerformed);
 }
\ No newline at end of file